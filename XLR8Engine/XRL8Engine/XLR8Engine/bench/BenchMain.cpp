@@ -0,0 +1,112 @@
+#include "Benchmark.h"
+#include "MacroBenchmarks.h"
+#include "Core/FrameLog.h"
+#include "Core/Profiler.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @file BenchMain.cpp
+ * @brief Entry point of xlr8_bench.
+ *
+ * Options:
+ *   --filter <text>        Only run benchmarks whose "group/name" contains the text.
+ *   --actors <n,n,...>     Scene sizes of the macro benchmarks (default 100,1000,10000).
+ *   --min-time <ms>        Minimum duration of one repetition (default 50).
+ *   --repetitions <n>      Repetitions per benchmark (default 5).
+ *   --json <path>          Write the results as JSON.
+ *   --baseline <path>      Compare with a previous --json file; exit 2 on regressions.
+ *   --threshold <fraction> Allowed slowdown against the baseline (default 0.10).
+ *   --replay <log>         Also benchmark a recorded session (XLR8Engine --record).
+ */
+
+namespace {
+    std::vector<std::size_t>
+        parseCounts(const char* text) {
+        std::vector<std::size_t> counts;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (!item.empty()) {
+                counts.push_back(static_cast<std::size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+            }
+        }
+        return counts;
+    }
+}
+
+int
+main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    std::vector<std::size_t> actorCounts = { 100, 1000, 10000 };
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 0.10;
+    std::vector<std::string> replayPaths;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--actors") == 0 && hasValue) {
+            actorCounts = parseCounts(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            options.minTimeMs = std::strtod(argv[++i], nullptr);
+        }
+        else if (std::strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+            options.repetitions = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            threshold = std::strtod(argv[++i], nullptr);
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            replayPaths.push_back(argv[++i]);
+        }
+        else {
+            std::cerr << "Unknown option " << argv[i] << "\n";
+            return 1;
+        }
+    }
+
+    // Las zonas del profiler no deben entrar en los tiempos del motor
+    Profiler::get().setEnabled(false);
+
+    MacroBenchmarks::registerScenes(actorCounts);
+    for (const std::string& path : replayPaths) {
+        FrameReplay replay;
+        if (!replay.load(path)) {
+            std::cerr << "Failed to read replay " << path << "\n";
+            return 1;
+        }
+        const std::size_t slash = path.find_last_of("/\\");
+        MacroBenchmarks::registerReplay(slash == std::string::npos ? path : path.substr(slash + 1), replay);
+    }
+    const std::vector<BenchmarkResult> results = Benchmark::runAll(options);
+
+    if (!jsonPath.empty() && !Benchmark::writeJson(jsonPath, results)) {
+        std::cerr << "Failed to write " << jsonPath << "\n";
+        return 1;
+    }
+
+    if (!baselinePath.empty()) {
+        const int regressions = Benchmark::compareWithBaseline(baselinePath, results, threshold);
+        if (regressions < 0) {
+            std::cerr << "Failed to read baseline " << baselinePath << "\n";
+            return 1;
+        }
+        if (regressions > 0) {
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,249 @@
+#include "Benchmark.h"
+#include "Math/SIMD.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+/**
+ * @file Benchmark.cpp
+ * @brief Calibration, reporting and baseline comparison of the benchmark harness.
+ */
+
+namespace {
+    /**
+     * @struct RegisteredBenchmark
+     * @brief A benchmark waiting to run.
+     */
+    struct
+        RegisteredBenchmark {
+        std::string group;
+        std::string name;
+        BenchmarkFunction function;
+    };
+
+    std::vector<RegisteredBenchmark>&
+        registry() {
+        static std::vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    const uint64_t kMaxIterations = 1ull << 32; ///< Calibration stops growing here.
+
+    /**
+     * @brief Grows the iteration count until a run lasts at least the minimum time.
+     */
+    uint64_t
+        calibrate(const BenchmarkFunction& function, double minTimeNs) {
+        uint64_t iterations = 1;
+        while (iterations < kMaxIterations) {
+            BenchmarkState state(iterations);
+            function(state);
+            const double elapsed = state.getElapsedNs();
+            if (elapsed >= minTimeNs) {
+                break;
+            }
+            // Salta directo cerca del objetivo, sin crecer mas de 10x por paso
+            const double scale = elapsed > 0.0 ? minTimeNs * 1.2 / elapsed : 10.0;
+            iterations = static_cast<uint64_t>(static_cast<double>(iterations) * std::min(10.0, std::max(2.0, scale)));
+        }
+        return iterations;
+    }
+
+    void
+        writeJsonString(std::ostream& os, const std::string& text) {
+        os << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                os << '\\';
+            }
+            os << c;
+        }
+        os << '"';
+    }
+
+    /**
+     * @brief Reads the text of a "key": "value" pair on @p line.
+     */
+    bool
+        readString(const std::string& line, const std::string& key, std::string& value) {
+        const std::string pattern = "\"" + key + "\": \"";
+        const std::size_t start = line.find(pattern);
+        if (start == std::string::npos) {
+            return false;
+        }
+        const std::size_t begin = start + pattern.size();
+        const std::size_t end = line.find('"', begin);
+        if (end == std::string::npos) {
+            return false;
+        }
+        value = line.substr(begin, end - begin);
+        return true;
+    }
+
+    /**
+     * @brief Reads the number of a "key": number pair on @p line.
+     */
+    bool
+        readNumber(const std::string& line, const std::string& key, double& value) {
+        const std::string pattern = "\"" + key + "\": ";
+        const std::size_t start = line.find(pattern);
+        if (start == std::string::npos) {
+            return false;
+        }
+        value = std::strtod(line.c_str() + start + pattern.size(), nullptr);
+        return true;
+    }
+}
+
+namespace Benchmark {
+
+    void
+        registerBenchmark(const std::string& group, const std::string& name, BenchmarkFunction function) {
+        registry().push_back(RegisteredBenchmark{ group, name, std::move(function) });
+    }
+
+    std::vector<BenchmarkResult>
+        runAll(const BenchmarkOptions& options) {
+        std::vector<BenchmarkResult> results;
+        char line[192];
+        std::snprintf(line, sizeof(line), "%-44s %12s %14s %14s %14s\n",
+            "benchmark", "iterations", "median ns", "min ns", "max ns");
+        std::cout << line;
+
+        for (const RegisteredBenchmark& benchmark : registry()) {
+            const std::string fullName = benchmark.group + "/" + benchmark.name;
+            if (!options.filter.empty() && fullName.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            BenchmarkResult result;
+            result.group = benchmark.group;
+            result.name = benchmark.name;
+            result.iterations = calibrate(benchmark.function, options.minTimeMs * 1e6);
+
+            std::vector<double> samples;
+            for (int repetition = 0; repetition < std::max(1, options.repetitions); ++repetition) {
+                BenchmarkState state(result.iterations);
+                benchmark.function(state);
+                samples.push_back(state.getElapsedNs() / static_cast<double>(result.iterations));
+                result.counters = state.getCounters();
+            }
+            std::sort(samples.begin(), samples.end());
+            result.medianNs = samples[samples.size() / 2];
+            result.minNs = samples.front();
+            result.maxNs = samples.back();
+
+            std::snprintf(line, sizeof(line), "%-44.44s %12llu %14.2f %14.2f %14.2f",
+                fullName.c_str(), static_cast<unsigned long long>(result.iterations),
+                result.medianNs, result.minNs, result.maxNs);
+            std::cout << line;
+            for (const auto& counter : result.counters) {
+                std::cout << "  " << counter.first << "=" << counter.second;
+            }
+            std::cout << std::endl;
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    /**
+     * @brief One benchmark per line, so compareWithBaseline() can read the file back
+     * without a JSON library.
+     */
+    bool
+        writeJson(const std::string& path, const std::vector<BenchmarkResult>& results) {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        char date[32];
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        file << "{\n  \"context\": {\"date\": \"" << date << "\", \"compiler\": ";
+#if defined(__clang__)
+        writeJsonString(file, std::string("clang ") + __clang_version__);
+#elif defined(__GNUC__)
+        writeJsonString(file, std::string("gcc ") + __VERSION__);
+#elif defined(_MSC_VER)
+        writeJsonString(file, "msvc " + std::to_string(_MSC_VER));
+#else
+        writeJsonString(file, "unknown");
+#endif
+#ifdef NDEBUG
+        file << ", \"build\": \"release\"";
+#else
+        file << ", \"build\": \"debug\"";
+#endif
+        file << ", \"simd_width\": " << XLR8_SIMD_WIDTH
+            << ", \"hardware_threads\": " << std::thread::hardware_concurrency() << "},\n";
+
+        file << "  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BenchmarkResult& result = results[i];
+            file << "    {\"group\": ";
+            writeJsonString(file, result.group);
+            file << ", \"name\": ";
+            writeJsonString(file, result.name);
+            file << ", \"iterations\": " << result.iterations
+                << ", \"median_ns\": " << result.medianNs
+                << ", \"min_ns\": " << result.minNs
+                << ", \"max_ns\": " << result.maxNs
+                << ", \"counters\": {";
+            bool first = true;
+            for (const auto& counter : result.counters) {
+                file << (first ? "" : ", ");
+                writeJsonString(file, counter.first);
+                file << ": " << counter.second;
+                first = false;
+            }
+            file << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n}\n";
+        return file.good();
+    }
+
+    int
+        compareWithBaseline(const std::string& path, const std::vector<BenchmarkResult>& results,
+            double threshold) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return -1;
+        }
+
+        std::map<std::string, double> baseline;
+        std::string line;
+        while (std::getline(file, line)) {
+            std::string group;
+            std::string name;
+            double median = 0.0;
+            if (readString(line, "group", group) && readString(line, "name", name) &&
+                readNumber(line, "median_ns", median)) {
+                baseline[group + "/" + name] = median;
+            }
+        }
+
+        int regressions = 0;
+        char text[192];
+        for (const BenchmarkResult& result : results) {
+            auto it = baseline.find(result.group + "/" + result.name);
+            if (it == baseline.end() || it->second <= 0.0) {
+                continue;
+            }
+            const double ratio = result.medianNs / it->second;
+            if (ratio > 1.0 + threshold) {
+                std::snprintf(text, sizeof(text), "REGRESSION %s/%s: %.2f ns -> %.2f ns (%+.1f%%)\n",
+                    result.group.c_str(), result.name.c_str(), it->second, result.medianNs,
+                    (ratio - 1.0) * 100.0);
+                std::cout << text;
+                ++regressions;
+            }
+        }
+        return regressions;
+    }
+}
@@ -0,0 +1,197 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @file Benchmark.h
+ * @brief Minimal benchmark harness used by xlr8_bench.
+ *
+ * A benchmark is a function that runs its measured code once per iteration of a
+ * BenchmarkState range loop; setup before the loop is not timed:
+ *
+ *     XLR8_BENCHMARK("Micro", "CVector2/normalized") {
+ *         CVector2 v(3.f, 4.f);
+ *         for (auto _ : state) {
+ *             doNotOptimize(v.normalized());
+ *         }
+ *     }
+ *
+ * The harness raises the iteration count until one run lasts the minimum time, then
+ * repeats the run and reports the median, fastest and slowest time per iteration.
+ */
+
+/**
+ * @brief Keeps the compiler from optimizing @p value, or the code that produced it, away.
+ */
+template<typename T>
+inline void
+doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @class BenchmarkState
+ * @brief Iteration count, timer and custom counters of one benchmark run.
+ */
+class
+    BenchmarkState {
+public:
+    explicit BenchmarkState(uint64_t iterations) : m_iterations(iterations) {}
+
+    /**
+     * @brief Range loop iterator. begin() starts the timer and the end test stops it.
+     */
+    class
+        Iterator {
+    public:
+        Iterator(BenchmarkState* state, uint64_t remaining) : m_state(state), m_remaining(remaining) {}
+
+        bool
+            operator!=(const Iterator&) {
+            if (m_remaining != 0) {
+                return true;
+            }
+            m_state->stopTimer();
+            return false;
+        }
+
+        Iterator&
+            operator++() { --m_remaining; return *this; }
+
+        int
+            operator*() const { return 0; }
+
+    private:
+        BenchmarkState* m_state;  ///< Estado dueno del temporizador.
+        uint64_t m_remaining;     ///< Iteraciones restantes.
+    };
+
+    Iterator
+        begin() {
+        m_start = std::chrono::steady_clock::now();
+        return Iterator(this, m_iterations);
+    }
+
+    Iterator
+        end() { return Iterator(this, 0); }
+
+    uint64_t
+        iterations() const { return m_iterations; }
+
+    /**
+     * @brief Records a custom value reported next to the timing, e.g. vertices per frame.
+     */
+    void
+        setCounter(const std::string& name, double value) { m_counters[name] = value; }
+
+    const std::map<std::string, double>&
+        getCounters() const { return m_counters; }
+
+    double
+        getElapsedNs() const { return m_elapsedNs; }
+
+private:
+    void
+        stopTimer() {
+        m_elapsedNs = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    uint64_t m_iterations;                          ///< Iteraciones por corrida.
+    std::chrono::steady_clock::time_point m_start;  ///< Inicio del lazo medido.
+    double m_elapsedNs = 0.0;                       ///< Duracion del lazo medido.
+    std::map<std::string, double> m_counters;       ///< Contadores propios.
+};
+
+/**
+ * @struct BenchmarkResult
+ * @brief Timing of one benchmark, in nanoseconds per iteration.
+ */
+struct
+    BenchmarkResult {
+    std::string group;       ///< "Micro" or "Macro".
+    std::string name;        ///< Unique name inside the suite.
+    uint64_t iterations = 0; ///< Iterations per repetition.
+    double medianNs = 0.0;   ///< Median over the repetitions.
+    double minNs = 0.0;      ///< Fastest repetition.
+    double maxNs = 0.0;      ///< Slowest repetition.
+    std::map<std::string, double> counters; ///< Counters of the last repetition.
+};
+
+/**
+ * @struct BenchmarkOptions
+ * @brief Command line settings of a suite run.
+ */
+struct
+    BenchmarkOptions {
+    std::string filter;          ///< Only names containing this text run.
+    double minTimeMs = 50.0;     ///< Minimum duration of one repetition.
+    int repetitions = 5;         ///< Repetitions per benchmark.
+};
+
+typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+namespace Benchmark {
+
+    /**
+     * @brief Adds a benchmark to the suite.
+     */
+    void
+        registerBenchmark(const std::string& group, const std::string& name, BenchmarkFunction function);
+
+    /**
+     * @brief Runs every registered benchmark that matches the filter, printing a line each.
+     */
+    std::vector<BenchmarkResult>
+        runAll(const BenchmarkOptions& options);
+
+    /**
+     * @brief Writes the results as JSON: a context object and a "benchmarks" array.
+     *
+     * @return false if the file could not be written.
+     */
+    bool
+        writeJson(const std::string& path, const std::vector<BenchmarkResult>& results);
+
+    /**
+     * @brief Compares the results with a JSON file written by writeJson().
+     *
+     * Prints every benchmark whose median grew by more than @p threshold (0.10 = 10%).
+     *
+     * @return Number of regressions, or -1 if the baseline could not be read.
+     */
+    int
+        compareWithBaseline(const std::string& path, const std::vector<BenchmarkResult>& results,
+            double threshold);
+}
+
+/**
+ * @brief Registers a static benchmark at startup.
+ */
+struct
+    BenchmarkRegistrar {
+    BenchmarkRegistrar(const char* group, const char* name, void (*function)(BenchmarkState&)) {
+        Benchmark::registerBenchmark(group, name, function);
+    }
+};
+
+#define XLR8_BENCH_CONCAT_(a, b) a##b
+#define XLR8_BENCH_CONCAT(a, b) XLR8_BENCH_CONCAT_(a, b)
+
+/**
+ * @brief Defines and registers a benchmark. The body receives `BenchmarkState& state`.
+ */
+#define XLR8_BENCHMARK(group, name)                                                        \
+    static void XLR8_BENCH_CONCAT(benchmark_, __LINE__)(BenchmarkState& state);            \
+    static BenchmarkRegistrar XLR8_BENCH_CONCAT(registrar_, __LINE__)(group, name,         \
+        &XLR8_BENCH_CONCAT(benchmark_, __LINE__));                                         \
+    static void XLR8_BENCH_CONCAT(benchmark_, __LINE__)(BenchmarkState& state)
@@ -0,0 +1,148 @@
+#include "Benchmark.h"
+#include "MacroBenchmarks.h"
+#include "BaseApp.h"
+#include "ECS/Actor.h"
+#include "Render/NullRenderBackend.h"
+#include "Window.h"
+#include <cmath>
+
+/**
+ * @file MacroBenchmarks.cpp
+ * @brief Whole-frame benchmarks of N-actor scenes on a NullRenderBackend, and replays of
+ * recorded sessions.
+ */
+
+using EngineUtilities::TSharedPointer;
+using EngineUtilities::MakeShared;
+
+namespace {
+    const float kDeltaTime = 1.f / 60.f; ///< Fixed step of every benchmarked frame.
+
+    /**
+     * @class BenchScene
+     * @brief N actors with a shape each, bound to a TransformSync and drawn headless.
+     *
+     * Shapes cycle through every preset type so the render queue sees mixed geometry.
+     */
+    class
+        BenchScene {
+    public:
+        explicit BenchScene(std::size_t actorCount) {
+            m_window = MakeShared<Window>(new NullRenderBackend());
+            m_actors.reserve(actorCount);
+            m_transforms.reserve(actorCount);
+
+            const ShapeType types[] = { ShapeType::CIRCLE, ShapeType::RECTANGLE,
+                ShapeType::TRIANGLE, ShapeType::POLYGON };
+            for (std::size_t i = 0; i < actorCount; ++i) {
+                TSharedPointer<Actor> actor = MakeShared<Actor>("Bench Actor");
+                TSharedPointer<CShape> shape = actor->getComponent<CShape>();
+                shape->createShape(types[i % 4]);
+                shape->setFillColor(sf::Color(static_cast<sf::Uint8>(i), 128, 255));
+
+                TSharedPointer<Transform> transform = actor->getComponent<Transform>();
+                transform->setPosition(sf::Vector2f(static_cast<float>(i % 64) * 30.f,
+                    static_cast<float>(i / 64) * 30.f));
+                actor->bindTransform(m_sync);
+
+                m_transforms.push_back(transform.get());
+                m_actors.push_back(actor);
+            }
+            m_sync.flush();
+        }
+
+        /**
+         * @brief Moves and spins every actor, runs the components and syncs the transforms.
+         */
+        void
+            update() {
+            m_time += kDeltaTime;
+            const float wobble = std::sin(m_time) * 0.5f;
+            for (Transform* transform : m_transforms) {
+                const sf::Vector2f position = transform->getPosition();
+                transform->setPosition(sf::Vector2f(position.x + wobble, position.y));
+                transform->setRotation(transform->getRotation() + 1.f);
+            }
+            for (auto& actor : m_actors) {
+                actor->update(kDeltaTime);
+            }
+            m_sync.flush();
+        }
+
+        void
+            render() {
+            m_window->clear();
+            for (auto& actor : m_actors) {
+                actor->render(m_window);
+            }
+            m_window->display();
+        }
+
+        const RenderStats&
+            getFrameStats() const { return m_window->getFrameStats(); }
+
+    private:
+        TSharedPointer<Window> m_window;                 ///< Ventana sobre NullRenderBackend.
+        TransformSync m_sync;                            ///< Empuja transformaciones a las formas.
+        std::vector<TSharedPointer<Actor>> m_actors;     ///< Actores de la escena.
+        std::vector<Transform*> m_transforms;            ///< Transformaciones de los actores.
+        float m_time = 0.f;                              ///< Tiempo simulado.
+    };
+
+    void
+        setSceneCounters(BenchmarkState& state, const BenchScene& scene, std::size_t actorCount) {
+        const RenderStats& stats = scene.getFrameStats();
+        state.setCounter("actors", static_cast<double>(actorCount));
+        state.setCounter("drawCalls", static_cast<double>(stats.drawCalls));
+        state.setCounter("vertices", static_cast<double>(stats.vertices));
+    }
+}
+
+namespace MacroBenchmarks {
+
+    void
+        registerScenes(const std::vector<std::size_t>& actorCounts) {
+        for (std::size_t actorCount : actorCounts) {
+            const std::string suffix = "/actors:" + std::to_string(actorCount);
+
+            Benchmark::registerBenchmark("Macro", "Scene/update" + suffix, [actorCount](BenchmarkState& state) {
+                BenchScene scene(actorCount);
+                for (auto _ : state) {
+                    scene.update();
+                }
+                state.setCounter("actors", static_cast<double>(actorCount));
+                });
+
+            Benchmark::registerBenchmark("Macro", "Scene/render" + suffix, [actorCount](BenchmarkState& state) {
+                BenchScene scene(actorCount);
+                for (auto _ : state) {
+                    scene.render();
+                }
+                setSceneCounters(state, scene, actorCount);
+                });
+
+            Benchmark::registerBenchmark("Macro", "Scene/frame" + suffix, [actorCount](BenchmarkState& state) {
+                BenchScene scene(actorCount);
+                for (auto _ : state) {
+                    scene.update();
+                    scene.render();
+                }
+                setSceneCounters(state, scene, actorCount);
+                });
+        }
+    }
+
+    void
+        registerReplay(const std::string& name, const FrameReplay& replay) {
+        Benchmark::registerBenchmark("Macro", "Replay/" + name, [replay](BenchmarkState& state) {
+            for (auto _ : state) {
+                BaseApp app;
+                app.setReplay(replay);
+                app.init();
+                while (app.runFrame()) {
+                }
+            }
+            state.setCounter("frames", static_cast<double>(replay.getFrameCount()));
+            });
+    }
+}
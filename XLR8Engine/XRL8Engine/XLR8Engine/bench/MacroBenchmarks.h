@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class FrameReplay;
+
+/**
+ * @file MacroBenchmarks.h
+ * @brief Registers the whole-scene benchmarks, which take their size from the command line.
+ */
+
+namespace MacroBenchmarks {
+
+    /**
+     * @brief Registers the update, render and full frame benchmarks for each scene size.
+     *
+     * @param actorCounts Number of actors of each scene.
+     */
+    void
+        registerScenes(const std::vector<std::size_t>& actorCounts);
+
+    /**
+     * @brief Registers a benchmark that replays a recorded session through BaseApp, so a
+     * captured hitch can be tracked against a baseline.
+     *
+     * @param name Name of the benchmark, usually the log's file name.
+     * @param replay Loaded frame log.
+     */
+    void
+        registerReplay(const std::string& name, const FrameReplay& replay);
+}
@@ -0,0 +1,473 @@
+#include "Benchmark.h"
+#include "Assets/AssetCompression.h"
+#include "Assets/AssetManager.h"
+#include "ECS/Actor.h"
+#include "ECS/EntityNameIndex.h"
+#include "ECS/StaticWorld.h"
+#include "ECS/TweenSystem.h"
+#include "Math/CVector2.h"
+#include "Server/SimulationServer.h"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+/**
+ * @file MicroBenchmarks.cpp
+ * @brief Benchmarks of the engine's building blocks: smart pointers, component lookup,
+ * name lookup, static world iteration, vector math, shape creation, tweens, server ticks
+ * and asset loading.
+ */
+
+using EngineUtilities::TSharedPointer;
+using EngineUtilities::MakeShared;
+
+namespace {
+    const std::size_t kVectorCount = 1024; ///< Vectors per CVector2 iteration.
+    const std::size_t kAssetCount = 256;   ///< Small files per asset loading iteration.
+    const std::size_t kAssetSize = 4096;   ///< Bytes of each of those files.
+    const std::size_t kTweenCount = 10000; ///< Tweens advanced per TweenSystem iteration.
+    const std::size_t kServerWorldCount = 64;   ///< Worlds stepped per SimulationServer tick.
+    const std::size_t kServerWorldFloats = 4096; ///< Floats each of those worlds integrates per step.
+    const std::size_t kNamedActorCount = 1024; ///< Actors registered in the EntityNameIndex.
+    const std::size_t kStaticEntityCount = 10000; ///< Entities moved per StaticWorld iteration.
+
+    struct Position { float x = 0.f, y = 0.f; }; ///< Componente de StaticWorld.
+    struct Velocity { float x = 0.f, y = 0.f; }; ///< Componente de StaticWorld.
+    struct Health { int32_t value = 100; };      ///< Componente que el recorrido ignora.
+
+    /**
+     * @brief Deterministic vectors, so every run does the same work.
+     */
+    std::vector<CVector2>
+        makeVectors() {
+        std::vector<CVector2> vectors(kVectorCount);
+        uint32_t seed = 0x12345678u;
+        for (CVector2& vector : vectors) {
+            seed = seed * 1664525u + 1013904223u;
+            vector.x = static_cast<float>(seed >> 8) * (1.f / 16777216.f) * 200.f - 100.f;
+            seed = seed * 1664525u + 1013904223u;
+            vector.y = static_cast<float>(seed >> 8) * (1.f / 16777216.f) * 200.f - 100.f;
+        }
+        return vectors;
+    }
+
+    /**
+     * @brief Deterministic bytes that compress about as well as text data.
+     */
+    std::vector<uint8_t>
+        makeAssetBytes(std::size_t size, uint32_t seed) {
+        static const char kWords[][8] = { "sprite", "layer", "color", "0.5", "true", "pos", "{", "}" };
+        std::vector<uint8_t> bytes;
+        bytes.reserve(size + 8);
+        while (bytes.size() < size) {
+            seed = seed * 1664525u + 1013904223u;
+            const char* word = kWords[seed >> 29];
+            bytes.insert(bytes.end(), word, word + std::strlen(word));
+            bytes.push_back(' ');
+        }
+        bytes.resize(size);
+        return bytes;
+    }
+
+    /**
+     * @brief Stops the run if a round trip check fails: timing a broken codec or archive
+     * would only produce meaningless numbers.
+     */
+    void
+        require(bool condition, const std::string& what) {
+        if (!condition) {
+            std::cerr << "Check failed: " << what << "\n";
+            std::exit(1);
+        }
+    }
+
+    /**
+     * @brief Checks that every file of an archive reads back as written, and that a copy
+     * cut short by one byte is rejected by open().
+     */
+    void
+        verifyArchive(const std::string& path, const std::vector<std::string>& names,
+            const std::vector<std::vector<uint8_t>>& contents) {
+        {
+            AssetArchive archive;
+            require(archive.open(path), "open " + path);
+            require(archive.getEntryCount() == names.size(), "entry count of " + path);
+            std::vector<uint8_t> scratch;
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                const uint32_t index = archive.find(names[i]);
+                require(index != AssetArchive::kNotFound, names[i] + " missing from " + path);
+                const uint8_t* data = archive.view(index, scratch);
+                require(data != nullptr && archive.getSize(index) == contents[i].size() &&
+                    std::memcmp(data, contents[i].data(), contents[i].size()) == 0,
+                    names[i] + " does not round trip through " + path);
+            }
+        }
+
+        const std::string truncatedPath = path + ".truncated";
+        std::filesystem::copy_file(path, truncatedPath, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::resize_file(truncatedPath, std::filesystem::file_size(path) - 1);
+        AssetArchive truncated;
+        require(!truncated.open(truncatedPath), "truncated " + path + " was accepted");
+        truncated.close();
+        std::filesystem::remove(truncatedPath);
+    }
+
+    /**
+     * @struct AssetFixture
+     * @brief The same small files written loose in a directory and packed in an archive.
+     */
+    struct
+        AssetFixture {
+        std::string directory;           ///< Carpeta de los archivos sueltos.
+        std::string archivePath;         ///< Archivo empaquetado con compresion.
+        std::string storedArchivePath;   ///< Archivo empaquetado sin compresion.
+        std::vector<std::string> names;  ///< Nombres relativos de los archivos.
+    };
+
+    const AssetFixture&
+        getAssetFixture() {
+        static const AssetFixture fixture = []() {
+            AssetFixture result;
+            const std::filesystem::path root = std::filesystem::temp_directory_path() / "xlr8_bench_assets";
+            std::filesystem::create_directories(root);
+            result.directory = root.string();
+            result.archivePath = (root / "assets.xpak").string();
+            result.storedArchivePath = (root / "assets_stored.xpak").string();
+
+            AssetArchiveWriter writer;
+            AssetArchiveWriter storedWriter;
+            std::vector<std::vector<uint8_t>> contents;
+            for (std::size_t i = 0; i < kAssetCount; ++i) {
+                const std::string name = "file_" + std::to_string(i) + ".bin";
+                const std::vector<uint8_t> bytes = makeAssetBytes(kAssetSize, static_cast<uint32_t>(i));
+                std::ofstream file(root / name, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                writer.addData(name, bytes);
+                storedWriter.addData(name, bytes, false);
+                result.names.push_back(name);
+                contents.push_back(bytes);
+            }
+            require(writer.write(result.archivePath), "write " + result.archivePath);
+            require(storedWriter.write(result.storedArchivePath), "write " + result.storedArchivePath);
+            verifyArchive(result.archivePath, result.names, contents);
+            verifyArchive(result.storedArchivePath, result.names, contents);
+            return result;
+        }();
+        return fixture;
+    }
+}
+
+// === TSharedPointer ===
+
+XLR8_BENCHMARK("Micro", "TSharedPointer/copy") {
+    TSharedPointer<Transform> source = MakeShared<Transform>();
+    for (auto _ : state) {
+        TSharedPointer<Transform> copy(source);
+        doNotOptimize(copy);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "TSharedPointer/move") {
+    TSharedPointer<Transform> first = MakeShared<Transform>();
+    TSharedPointer<Transform> second;
+    for (auto _ : state) {
+        second = std::move(first);
+        first = std::move(second);
+        doNotOptimize(first);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "TSharedPointer/dynamic_pointer_cast") {
+    TSharedPointer<Component> component = MakeShared<CShape>().dynamic_pointer_cast<Component>();
+    for (auto _ : state) {
+        TSharedPointer<CShape> shape = component.dynamic_pointer_cast<CShape>();
+        doNotOptimize(shape);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "TSharedPointer/dynamic_pointer_cast_miss") {
+    TSharedPointer<Component> component = MakeShared<Transform>().dynamic_pointer_cast<Component>();
+    for (auto _ : state) {
+        TSharedPointer<CShape> shape = component.dynamic_pointer_cast<CShape>();
+        doNotOptimize(shape);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "MakeShared/Transform") {
+    for (auto _ : state) {
+        TSharedPointer<Transform> transform = MakeShared<Transform>();
+        doNotOptimize(transform);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "MakeShared/Actor") {
+    for (auto _ : state) {
+        TSharedPointer<Actor> actor = MakeShared<Actor>("Bench Actor");
+        doNotOptimize(actor);
+    }
+}
+
+// === Entity ===
+
+XLR8_BENCHMARK("Micro", "Entity/getComponent_first") {
+    Actor actor("Bench Actor");
+    for (auto _ : state) {
+        TSharedPointer<CShape> shape = actor.getComponent<CShape>();
+        doNotOptimize(shape);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "Entity/getComponent_second") {
+    Actor actor("Bench Actor");
+    for (auto _ : state) {
+        TSharedPointer<Transform> transform = actor.getComponent<Transform>();
+        doNotOptimize(transform);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "Entity/getComponent_missing") {
+    Actor actor("Bench Actor");
+    for (auto _ : state) {
+        TSharedPointer<CSprite> sprite = actor.getComponent<CSprite>();
+        doNotOptimize(sprite);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "NameTable/intern_existing") {
+    const std::string name = "Bench Actor";
+    NameTable::get().intern(name);
+    for (auto _ : state) {
+        doNotOptimize(NameTable::get().intern(name));
+    }
+}
+
+XLR8_BENCHMARK("Micro", "EntityNameIndex/find_1k") {
+    std::vector<TSharedPointer<Actor>> actors;
+    std::vector<NameId> names;
+    EntityNameIndex index;
+    for (std::size_t i = 0; i < kNamedActorCount; ++i) {
+        actors.push_back(MakeShared<Actor>("Bench Actor " + std::to_string(i)));
+        names.push_back(actors.back()->getNameId());
+        index.add(names.back(), actors.back().get());
+    }
+    std::size_t next = 0;
+    for (auto _ : state) {
+        doNotOptimize(index.find(names[next]));
+        next = (next + 1) & (kNamedActorCount - 1);
+    }
+}
+
+// === StaticWorld ===
+
+XLR8_BENCHMARK("Micro", "StaticWorld/each_10k") {
+    // Una de cada cuatro entidades no se mueve
+    StaticWorld<Position, Velocity, Health> world;
+    for (std::size_t i = 0; i < kStaticEntityCount; ++i) {
+        const StaticEntity entity = world.create();
+        world.add(entity, Position());
+        world.add(entity, Health());
+        if (i % 4 != 0) {
+            world.add(entity, Velocity{ 1.f, 0.5f });
+        }
+    }
+    for (auto _ : state) {
+        world.each<Position, Velocity>([](Position& position, const Velocity& velocity) {
+            position.x += velocity.x * (1.f / 60.f);
+            position.y += velocity.y * (1.f / 60.f);
+        });
+    }
+    doNotOptimize(world.get<Position>(world.create()));
+    state.setCounter("entities", static_cast<double>(kStaticEntityCount));
+}
+
+XLR8_BENCHMARK("Micro", "StaticWorld/get") {
+    StaticWorld<Position, Velocity, Health> world;
+    const StaticEntity entity = world.create();
+    world.add(entity, Velocity{ 1.f, 2.f });
+    for (auto _ : state) {
+        doNotOptimize(world.get<Velocity>(entity));
+    }
+}
+
+// === CVector2 ===
+
+XLR8_BENCHMARK("Micro", "CVector2/add_scale_x1024") {
+    std::vector<CVector2> vectors = makeVectors();
+    const CVector2 offset(1.5f, -0.5f);
+    for (auto _ : state) {
+        for (CVector2& vector : vectors) {
+            vector = (vector + offset) * 0.999f;
+        }
+        doNotOptimize(vectors.data());
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CVector2/dot_x1024") {
+    std::vector<CVector2> vectors = makeVectors();
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (std::size_t i = 1; i < vectors.size(); ++i) {
+            sum += vectors[i - 1].dot(vectors[i]);
+        }
+        doNotOptimize(sum);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CVector2/normalized_x1024") {
+    std::vector<CVector2> vectors = makeVectors();
+    std::vector<CVector2> out(vectors.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            out[i] = vectors[i].normalized();
+        }
+        doNotOptimize(out.data());
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CVector2/length_x1024") {
+    std::vector<CVector2> vectors = makeVectors();
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (const CVector2& vector : vectors) {
+            sum += vector.length();
+        }
+        doNotOptimize(sum);
+    }
+}
+
+// === CShape ===
+
+XLR8_BENCHMARK("Micro", "CShape/createShape_circle") {
+    CShape shape;
+    for (auto _ : state) {
+        shape.createShape(ShapeType::CIRCLE);
+        doNotOptimize(shape.getShape());
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CShape/createShape_rectangle") {
+    CShape shape;
+    for (auto _ : state) {
+        shape.createShape(ShapeType::RECTANGLE);
+        doNotOptimize(shape.getShape());
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CShape/createShape_triangle") {
+    CShape shape;
+    for (auto _ : state) {
+        shape.createShape(ShapeType::TRIANGLE);
+        doNotOptimize(shape.getShape());
+    }
+}
+
+XLR8_BENCHMARK("Micro", "CShape/createShape_polygon") {
+    CShape shape;
+    for (auto _ : state) {
+        shape.createShape(ShapeType::POLYGON);
+        doNotOptimize(shape.getShape());
+    }
+}
+
+// === Tweens ===
+
+XLR8_BENCHMARK("Micro", "TweenSystem/update_10k") {
+    // Mitad posicion, mitad color, repartidos entre cuatro curvas
+    std::vector<Transform> transforms(kTweenCount / 2);
+    std::vector<CShape> shapes(kTweenCount / 2);
+    const EaseType curves[] = { EASE_LINEAR, EASE_OUT_QUAD, EASE_IN_OUT_CUBIC, EASE_SMOOTHSTEP };
+    TweenSystem tweens;
+    for (std::size_t i = 0; i < transforms.size(); ++i) {
+        tweens.tweenPosition(transforms[i], sf::Vector2f(100.f, 50.f), 1e6f, curves[i % 4]);
+        shapes[i].createShape(ShapeType::RECTANGLE);
+        tweens.tweenColor(shapes[i], sf::Color::Red, 1e6f, curves[i % 4]);
+    }
+    for (auto _ : state) {
+        tweens.update(1.f / 60.f);
+    }
+    doNotOptimize(transforms.data());
+    state.setCounter("tweens", static_cast<double>(tweens.size()));
+}
+
+// === Server ===
+
+XLR8_BENCHMARK("Micro", "SimulationServer/tick_64_worlds") {
+    // Cada tick es exactamente un paso por mundo
+    SimulationServer server;
+    for (std::size_t i = 0; i < kServerWorldCount; ++i) {
+        World* world = server.getWorld(server.addWorld());
+        float* values = world->getArena().createArray<float>(kServerWorldFloats);
+        world->setStepCallback([values](World&, float deltaTime) {
+            for (std::size_t v = 0; v < kServerWorldFloats; ++v) {
+                values[v] += deltaTime;
+            }
+        });
+    }
+    for (auto _ : state) {
+        server.tick(1.0 / 60.0);
+    }
+    state.setCounter("worlds", static_cast<double>(kServerWorldCount));
+}
+
+// === Assets ===
+
+XLR8_BENCHMARK("Micro", "AssetCompression/decompress_64k") {
+    const std::vector<uint8_t> source = makeAssetBytes(65536, 7u);
+    std::vector<uint8_t> packed;
+    AssetCompression::compress(source.data(), source.size(), packed);
+    std::vector<uint8_t> output(source.size());
+    require(AssetCompression::decompress(packed.data(), packed.size(), output.data(), output.size()) &&
+        output == source, "AssetCompression round trip");
+    require(!AssetCompression::decompress(packed.data(), packed.size() - 1, output.data(), output.size()),
+        "AssetCompression accepted a truncated stream");
+    std::vector<uint8_t> larger(source.size() + 1);
+    require(!AssetCompression::decompress(packed.data(), packed.size(), larger.data(), larger.size()),
+        "AssetCompression accepted a stream shorter than its declared size");
+    for (auto _ : state) {
+        AssetCompression::decompress(packed.data(), packed.size(), output.data(), output.size());
+        doNotOptimize(output);
+    }
+    state.setCounter("ratio", static_cast<double>(packed.size()) / static_cast<double>(source.size()));
+}
+
+XLR8_BENCHMARK("Micro", "AssetManager/load_loose_256") {
+    const AssetFixture& fixture = getAssetFixture();
+    for (auto _ : state) {
+        AssetManager manager;
+        std::vector<AssetHandle<AssetBytes>> handles;
+        for (const std::string& name : fixture.names) {
+            handles.push_back(manager.loadBinary(fixture.directory + "/" + name));
+        }
+        manager.waitAll();
+        doNotOptimize(handles);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "AssetManager/load_archive_256") {
+    const AssetFixture& fixture = getAssetFixture();
+    for (auto _ : state) {
+        AssetManager manager;
+        manager.mountArchive(fixture.archivePath);
+        std::vector<AssetHandle<AssetBytes>> handles;
+        for (const std::string& name : fixture.names) {
+            handles.push_back(manager.loadBinary(name));
+        }
+        manager.waitAll();
+        doNotOptimize(handles);
+    }
+}
+
+XLR8_BENCHMARK("Micro", "AssetManager/load_archive_stored_256") {
+    const AssetFixture& fixture = getAssetFixture();
+    for (auto _ : state) {
+        AssetManager manager;
+        manager.mountArchive(fixture.storedArchivePath);
+        std::vector<AssetHandle<AssetBytes>> handles;
+        for (const std::string& name : fixture.names) {
+            handles.push_back(manager.loadBinary(name));
+        }
+        manager.waitAll();
+        doNotOptimize(handles);
+    }
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file AssetArchive.h
+ * @brief Declares the packed asset archive: its file layout, the build-time writer and
+ * the memory-mapped reader.
+ *
+ * Layout of a .xpak file, all integers little-endian:
+ *   ArchiveHeader
+ *   entry data, each entry starting at a multiple of the archive alignment
+ *   ArchiveEntry[entryCount], sorted by name hash
+ *   name table: the entry names, not terminated
+ */
+
+namespace AssetArchiveFormat {
+
+    const char kMagic[4] = { 'X', 'P', 'A', 'K' }; ///< First bytes of every archive.
+    const uint32_t kVersion = 1;                  ///< Layout version written by this build.
+    const uint32_t kEntryCompressed = 1u << 0;    ///< Entry flag: stored with AssetCompression.
+
+    /**
+     * @struct ArchiveHeader
+     * @brief Start of the archive file.
+     */
+    struct
+        ArchiveHeader {
+        char magic[4];        ///< kMagic.
+        uint32_t version;     ///< kVersion.
+        uint32_t entryCount;  ///< Entradas de la tabla.
+        uint32_t alignment;   ///< Alineacion de los datos de cada entrada.
+        uint64_t tocOffset;   ///< Inicio de la tabla de entradas.
+        uint64_t namesOffset; ///< Inicio de la tabla de nombres.
+        uint64_t namesSize;   ///< Bytes de la tabla de nombres.
+    };
+
+    /**
+     * @struct ArchiveEntry
+     * @brief Table of contents record of one file.
+     */
+    struct
+        ArchiveEntry {
+        uint64_t hash;        ///< hashName() del nombre; la tabla esta ordenada por el.
+        uint64_t offset;      ///< Inicio de los datos guardados.
+        uint64_t storedSize;  ///< Bytes guardados en el archivo.
+        uint64_t size;        ///< Bytes del archivo original.
+        uint32_t nameOffset;  ///< Inicio del nombre en la tabla de nombres.
+        uint32_t nameLength;  ///< Longitud del nombre.
+        uint32_t flags;       ///< kEntryCompressed.
+        uint32_t reserved;    ///< Cero.
+    };
+
+    static_assert(sizeof(ArchiveHeader) == 40, "ArchiveHeader layout changed");
+    static_assert(sizeof(ArchiveEntry) == 48, "ArchiveEntry layout changed");
+
+    /**
+     * @brief Turns a path into an entry name: backslashes become slashes and a leading
+     * "./" is dropped, so Windows and POSIX spellings find the same entry.
+     */
+    std::string
+        normalizeName(const std::string& path);
+
+    /**
+     * @brief FNV-1a hash of a normalized name.
+     */
+    uint64_t
+        hashName(const std::string& name);
+}
+
+/**
+ * @class AssetArchiveWriter
+ * @brief Collects files at build time and writes them as one archive.
+ *
+ * Compression is per entry: an entry is stored compressed only when that saves at least
+ * an eighth of its size, so already compressed formats such as PNG stay raw and can be
+ * read zero-copy.
+ */
+class
+    AssetArchiveWriter {
+public:
+    /**
+     * @brief Adds a file from disk under @p name.
+     *
+     * @return false if the file cannot be read.
+     */
+    bool
+        addFile(const std::string& name, const std::string& path, bool compress = true);
+
+    /**
+     * @brief Adds bytes already in memory under @p name. A later entry with the same
+     * name replaces the earlier one.
+     */
+    void
+        addData(const std::string& name, std::vector<uint8_t> bytes, bool compress = true);
+
+    /**
+     * @brief Writes the archive.
+     *
+     * @param path Output file.
+     * @param alignment Alignment of each entry's data, a power of two.
+     * @return false if the file cannot be written.
+     */
+    bool
+        write(const std::string& path, uint32_t alignment = 16) const;
+
+    std::size_t
+        getEntryCount() const { return m_entries.size(); }
+
+private:
+    /**
+     * @struct PendingEntry
+     * @brief A file waiting to be written.
+     */
+    struct
+        PendingEntry {
+        std::string name;           ///< Nombre normalizado.
+        std::vector<uint8_t> bytes; ///< Datos a guardar, comprimidos o no.
+        uint64_t size;              ///< Bytes originales.
+        bool compressed;            ///< Si bytes esta comprimido.
+    };
+
+    std::vector<PendingEntry> m_entries; ///< Entradas en orden de insercion.
+};
+
+/**
+ * @class AssetArchive
+ * @brief Read-only view of an archive mapped into memory.
+ *
+ * open() maps the whole file and validates the table of contents once; after that a
+ * lookup is a binary search over the hashes and an uncompressed entry is a pointer into
+ * the mapping, with no system call. Every const member function is safe to call from
+ * several threads.
+ */
+class
+    AssetArchive {
+public:
+    static constexpr uint32_t kNotFound = 0xFFFFFFFFu; ///< Returned by find() for a missing name.
+
+    AssetArchive() = default;
+
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /**
+     * @brief Maps @p path and checks its header and table of contents.
+     *
+     * @return false if the file cannot be mapped or is not a valid archive.
+     */
+    bool
+        open(const std::string& path);
+
+    /**
+     * @brief Unmaps the archive. Pointers returned by view() become invalid.
+     */
+    void
+        close();
+
+    bool
+        isOpen() const { return m_data != nullptr; }
+
+    const std::string&
+        getPath() const { return m_path; }
+
+    /**
+     * @brief Index of the entry named @p name, or kNotFound.
+     */
+    uint32_t
+        find(const std::string& name) const;
+
+    uint32_t
+        getEntryCount() const { return m_entryCount; }
+
+    /**
+     * @brief Name of entry @p index.
+     */
+    std::string
+        getName(uint32_t index) const;
+
+    /**
+     * @brief Original size of entry @p index.
+     */
+    std::size_t
+        getSize(uint32_t index) const { return static_cast<std::size_t>(m_entries[index].size); }
+
+    bool
+        isCompressed(uint32_t index) const { return (m_entries[index].flags & AssetArchiveFormat::kEntryCompressed) != 0; }
+
+    /**
+     * @brief Contents of entry @p index.
+     *
+     * An uncompressed entry is returned straight from the mapping and @p scratch is left
+     * untouched; a compressed one is expanded into @p scratch.
+     *
+     * @return nullptr if a compressed entry is corrupt. A pointer to an empty entry may
+     * not be dereferenced.
+     */
+    const uint8_t*
+        view(uint32_t index, std::vector<uint8_t>& scratch) const;
+
+private:
+    std::string m_path;                                       ///< Archivo abierto.
+    const uint8_t* m_data = nullptr;                          ///< Inicio del mapeo.
+    std::size_t m_size = 0;                                   ///< Bytes mapeados.
+    const AssetArchiveFormat::ArchiveEntry* m_entries = nullptr; ///< Tabla de entradas, dentro del mapeo.
+    const char* m_names = nullptr;                            ///< Tabla de nombres, dentro del mapeo.
+    uint32_t m_entryCount = 0;                                ///< Entradas de la tabla.
+    void* m_fileHandle = nullptr;                             ///< Windows: archivo abierto.
+    void* m_mappingHandle = nullptr;                          ///< Windows: objeto de mapeo.
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file AssetCompression.h
+ * @brief Fast byte-oriented LZ codec used for the entries of an asset archive.
+ *
+ * The stream uses the LZ4 block layout: each sequence is a token (literal count in the
+ * high nibble, match length minus four in the low one), extra length bytes, the literals
+ * and a two-byte little-endian offset. The last sequence only carries literals. The
+ * encoder trades ratio for speed; the decoder checks every read and write against the
+ * buffers, so a corrupt archive fails instead of overrunning memory.
+ */
+
+namespace AssetCompression {
+
+    /**
+     * @brief Worst-case compressed size of @p size bytes.
+     */
+    std::size_t
+        compressBound(std::size_t size);
+
+    /**
+     * @brief Compresses @p size bytes of @p source into @p output, replacing its contents.
+     */
+    void
+        compress(const uint8_t* source, std::size_t size, std::vector<uint8_t>& output);
+
+    /**
+     * @brief Decompresses a stream that must expand to exactly @p destinationSize bytes.
+     *
+     * @return false if the stream is malformed or does not match the size.
+     */
+    bool
+        decompress(const uint8_t* source, std::size_t sourceSize,
+            uint8_t* destination, std::size_t destinationSize);
+}
@@ -0,0 +1,372 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "Assets/AssetArchive.h"
+#include "Core/ThreadPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * @file AssetManager.h
+ * @brief Declares the AssetManager, which loads files on worker threads and caches them.
+ */
+
+/**
+ * @brief Raw file contents, the data of a binary asset.
+ */
+typedef std::vector<uint8_t> AssetBytes;
+
+/**
+ * @enum AssetType
+ * @brief Kind of data an asset decodes to.
+ */
+enum
+    AssetType {
+    ASSET_TEXTURE = 0, ///< sf::Texture, decoded to an image on a worker and uploaded by update().
+    ASSET_IMAGE = 1,   ///< sf::Image kept in system memory.
+    ASSET_FONT = 2,    ///< sf::Font.
+    ASSET_BINARY = 3   ///< AssetBytes, the file as is.
+};
+
+/**
+ * @enum AssetState
+ * @brief Loading state of an asset.
+ */
+enum
+    AssetState {
+    ASSET_LOADING = 0, ///< Queued, decoding, or waiting for update() to finish it.
+    ASSET_READY = 1,   ///< Data available.
+    ASSET_FAILED = 2   ///< The file could not be read or decoded.
+};
+
+/**
+ * @struct AssetStats
+ * @brief Counters of an AssetManager.
+ */
+struct
+    AssetStats {
+    uint64_t requests = 0;        ///< load*() calls.
+    uint64_t deduplicated = 0;    ///< Requests served by an asset already loading or cached.
+    uint64_t loads = 0;           ///< Files actually read.
+    uint64_t archiveLoads = 0;    ///< Part of loads served by a mounted archive.
+    uint64_t failures = 0;        ///< Loads that failed.
+    uint64_t evictions = 0;       ///< Unused assets dropped to stay under the budget.
+    std::size_t residentBytes = 0; ///< Estimated memory of every loaded asset.
+    std::size_t cachedBytes = 0;  ///< Part of residentBytes held by unreferenced assets.
+    std::size_t pending = 0;      ///< Assets still loading.
+};
+
+template<typename T>
+class AssetHandle;
+
+namespace AssetDetail {
+
+    /**
+     * @brief Maps a handle's data type to its AssetType.
+     */
+    template<typename T>
+    struct AssetTypeOf;
+
+    template<>
+    struct AssetTypeOf<sf::Texture> { static constexpr AssetType value = ASSET_TEXTURE; };
+
+    template<>
+    struct AssetTypeOf<sf::Image> { static constexpr AssetType value = ASSET_IMAGE; };
+
+    template<>
+    struct AssetTypeOf<sf::Font> { static constexpr AssetType value = ASSET_FONT; };
+
+    template<>
+    struct AssetTypeOf<AssetBytes> { static constexpr AssetType value = ASSET_BINARY; };
+
+    /**
+     * @struct AssetData
+     * @brief Decoded data of one asset. Which members are used depends on the AssetType.
+     */
+    struct
+        AssetData {
+        AssetBytes bytes;     ///< Contenido del archivo; las fuentes lo necesitan vivo.
+        std::size_t fileSize = 0; ///< Bytes del archivo original.
+        sf::Image image;      ///< Imagen decodificada.
+        sf::Texture texture;  ///< Textura subida por update().
+        sf::Font font;        ///< Fuente cargada desde bytes.
+    };
+}
+
+/**
+ * @class AssetManager
+ * @brief Loads textures, images, fonts and raw files without blocking the frame loop.
+ *
+ * A load*() call returns a handle at once. The file is read and decoded on a worker
+ * thread; textures are then uploaded by update(), which the main loop calls every frame
+ * and which uploads at most a few textures per call. Requests are deduplicated by path:
+ * while an asset is loading or cached, every request for its path shares it, so a file is
+ * never loaded twice.
+ *
+ * Archives mounted with mountArchive() are searched before the file system. An entry
+ * stored uncompressed is decoded straight from the archive mapping, without opening or
+ * reading a file.
+ *
+ * Handles count references. An asset nobody references stays cached, and unreferenced
+ * assets are evicted least recently used first whenever the resident memory exceeds the
+ * budget. Referenced assets are never evicted, so the budget can be exceeded while they
+ * are in use.
+ *
+ * Every member function and every handle must be used from the thread that owns the
+ * manager, and handles must not outlive it.
+ */
+class
+    AssetManager {
+public:
+    /**
+     * @param memoryBudget Resident bytes above which unused assets are evicted.
+     * @param workerCount Decoding threads, at least one.
+     */
+    explicit AssetManager(std::size_t memoryBudget = 256u << 20, std::size_t workerCount = 2);
+
+    /**
+     * @brief Waits for the running decodes and releases every asset.
+     */
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    /**
+     * @brief Serves later requests from a packed archive. Archives mounted later take
+     * priority, so a patch archive can override entries of the base one. Archives stay
+     * mapped until the manager is destroyed.
+     *
+     * @return false if the archive cannot be opened.
+     */
+    bool
+        mountArchive(const std::string& path);
+
+    AssetHandle<sf::Texture>
+        loadTexture(const std::string& path);
+
+    AssetHandle<sf::Image>
+        loadImage(const std::string& path);
+
+    AssetHandle<sf::Font>
+        loadFont(const std::string& path);
+
+    AssetHandle<AssetBytes>
+        loadBinary(const std::string& path);
+
+    /**
+     * @brief Finishes the decoded assets: uploads up to the per-frame texture budget and
+     * marks the rest ready. Call once per frame on the main thread.
+     */
+    void
+        update();
+
+    /**
+     * @brief Blocks until every requested asset is ready or failed, e.g. behind a loading screen.
+     */
+    void
+        waitAll();
+
+    /**
+     * @brief Textures update() uploads per call. Other assets are not limited.
+     */
+    void
+        setUploadsPerFrame(std::size_t uploads) { m_uploadsPerFrame = uploads; }
+
+    /**
+     * @brief Changes the budget and evicts unused assets down to it.
+     */
+    void
+        setMemoryBudget(std::size_t bytes);
+
+    std::size_t
+        getMemoryBudget() const { return m_memoryBudget; }
+
+    /**
+     * @brief Drops every unreferenced cached asset.
+     */
+    void
+        purgeUnused();
+
+    AssetStats
+        getStats() const;
+
+private:
+    template<typename T>
+    friend class AssetHandle;
+
+    static constexpr uint32_t kNone = 0xFFFFFFFFu; ///< Sin enlace en la lista LRU.
+
+    /**
+     * @struct Slot
+     * @brief One asset and its bookkeeping.
+     */
+    struct
+        Slot {
+        std::string path;                                  ///< Ruta, clave de deduplicacion.
+        EngineUtilities::TUniquePtr<AssetDetail::AssetData> data; ///< Datos, nulo mientras carga.
+        AssetType type = ASSET_BINARY;                     ///< Tipo de datos.
+        AssetState state = ASSET_LOADING;                  ///< Estado de carga.
+        uint32_t generation = 0;                           ///< Invalida handles de un slot reciclado.
+        uint32_t refs = 0;                                 ///< Handles vivos.
+        std::size_t bytes = 0;                             ///< Memoria estimada.
+        uint32_t lruPrev = kNone;                          ///< Vecino mas reciente en la lista LRU.
+        uint32_t lruNext = kNone;                          ///< Vecino mas antiguo en la lista LRU.
+        bool inLru = false;                                ///< Si esta en la lista LRU.
+        bool inUse = false;                                ///< Si el slot tiene un asset.
+    };
+
+    /**
+     * @struct Decoded
+     * @brief Result a worker hands back to the main thread.
+     */
+    struct
+        Decoded {
+        uint32_t slot;                                     ///< Slot de destino.
+        uint32_t generation;                               ///< Generacion al pedir la carga.
+        EngineUtilities::TUniquePtr<AssetDetail::AssetData> data; ///< Nulo si fallo.
+    };
+
+    /**
+     * @brief Returns the slot of @p path, starting a load if it is not known.
+     */
+    uint32_t
+        request(const std::string& path, AssetType type);
+
+    /**
+     * @brief Reads and decodes a file, or entry @p entry of @p archive when it is not
+     * null. Runs on a worker thread.
+     */
+    static EngineUtilities::TUniquePtr<AssetDetail::AssetData>
+        decode(const std::string& path, const AssetArchive* archive, uint32_t entry, AssetType type);
+
+    /**
+     * @brief Moves a decoded asset into its slot. Returns false if it is a texture and
+     * the upload budget of this update() is spent.
+     */
+    bool
+        finish(Decoded& decoded, std::size_t& uploads);
+
+    void
+        addRef(uint32_t slot);
+
+    void
+        release(uint32_t slot);
+
+    void
+        lruPushFront(uint32_t slot);
+
+    void
+        lruRemove(uint32_t slot);
+
+    /**
+     * @brief Evicts from the back of the LRU list until resident memory fits the budget.
+     */
+    void
+        trim(std::size_t budget);
+
+    void
+        freeSlot(uint32_t slot);
+
+    const void*
+        getData(uint32_t slot, uint32_t generation) const;
+
+    AssetState
+        getState(uint32_t slot, uint32_t generation) const;
+
+    std::vector<EngineUtilities::TUniquePtr<AssetArchive>> m_archives; ///< Archivos montados; viven mas que los slots.
+    std::vector<Slot> m_slots;                         ///< Assets, indexados por los handles.
+    std::vector<uint32_t> m_freeSlots;                 ///< Slots reciclables.
+    std::unordered_map<std::string, uint32_t> m_slotByPath; ///< Deduplicacion por ruta.
+    uint32_t m_lruHead = kNone;                        ///< Asset sin uso mas reciente.
+    uint32_t m_lruTail = kNone;                        ///< Asset sin uso mas antiguo.
+    std::size_t m_memoryBudget;                        ///< Presupuesto de memoria.
+    std::size_t m_uploadsPerFrame = 4;                 ///< Texturas subidas por update().
+    AssetStats m_stats;                                ///< Contadores.
+
+    std::vector<Decoded> m_ready;                      ///< Decodificados esperando subida.
+    std::mutex m_completedMutex;                       ///< Protege m_completed.
+    std::condition_variable m_completedSignal;         ///< Avisa a waitAll().
+    std::vector<Decoded> m_completed;                  ///< Entregados por los workers.
+    std::atomic<std::size_t> m_completedCount{ 0 };    ///< Tamano de m_completed sin bloquear.
+    std::atomic<bool> m_shuttingDown{ false };         ///< Los workers saltan trabajos pendientes.
+    ThreadPool m_workers;                              ///< Hilos de decodificacion; se destruye primero.
+};
+
+/**
+ * @class AssetHandle
+ * @brief Counted reference to an asset of an AssetManager.
+ *
+ * Copying a handle is an increment. get() returns nullptr until the asset is ready.
+ */
+template<typename T>
+class
+    AssetHandle {
+public:
+    AssetHandle() = default;
+
+    AssetHandle(const AssetHandle& other)
+        : m_manager(other.m_manager), m_slot(other.m_slot), m_generation(other.m_generation) {
+        if (m_manager != nullptr) {
+            m_manager->addRef(m_slot);
+        }
+    }
+
+    AssetHandle(AssetHandle&& other) noexcept
+        : m_manager(other.m_manager), m_slot(other.m_slot), m_generation(other.m_generation) {
+        other.m_manager = nullptr;
+    }
+
+    AssetHandle&
+        operator=(AssetHandle other) noexcept {
+        std::swap(m_manager, other.m_manager);
+        std::swap(m_slot, other.m_slot);
+        std::swap(m_generation, other.m_generation);
+        return *this;
+    }
+
+    ~AssetHandle() { reset(); }
+
+    /**
+     * @brief Drops the reference. The asset stays cached until the budget evicts it.
+     */
+    void
+        reset() {
+        if (m_manager != nullptr) {
+            m_manager->release(m_slot);
+            m_manager = nullptr;
+        }
+    }
+
+    bool
+        isValid() const { return m_manager != nullptr; }
+
+    AssetState
+        getState() const { return m_manager != nullptr ? m_manager->getState(m_slot, m_generation) : ASSET_FAILED; }
+
+    bool
+        isReady() const { return getState() == ASSET_READY; }
+
+    /**
+     * @brief The asset data, or nullptr while it is loading or if it failed.
+     */
+    const T*
+        get() const {
+        return m_manager != nullptr ? static_cast<const T*>(m_manager->getData(m_slot, m_generation)) : nullptr;
+    }
+
+    const T*
+        operator->() const { return get(); }
+
+private:
+    friend class AssetManager;
+
+    AssetHandle(AssetManager* manager, uint32_t slot)
+        : m_manager(manager), m_slot(slot), m_generation(manager->m_slots[slot].generation) {
+        m_manager->addRef(m_slot);
+    }
+
+    AssetManager* m_manager = nullptr; ///< Dueno del asset, nulo si el handle esta vacio.
+    uint32_t m_slot = 0;               ///< Slot del asset.
+    uint32_t m_generation = 0;         ///< Generacion del slot al crear el handle.
+};
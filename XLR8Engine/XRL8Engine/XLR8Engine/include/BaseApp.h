@@ -1,51 +1,199 @@
 ﻿#pragma once
 
 /**
- * @file CShape.h
- * @brief Declares the CShape class used to represent 2D shapes as components in the ECS system.
+ * @file BaseApp.h
+ * @brief Declares the BaseApp class that owns the window and runs the main loop.
  */
 
 #include "Prerequisites.h"
-#include "ECS/Component.h"
-
-class Window;
+#include "Window.h"
+#include "ECS/Actor.h"
+#include "Assets/AssetManager.h"
+#include "Core/FrameLog.h"
+#include "Core/BehaviourScheduler.h"
+#include "ECS/TweenSystem.h"
+#include "ECS/EntityNameIndex.h"
+#include "Render/NullRenderBackend.h"
+#include <chrono>
 
 /**
- * @class CShape
- * @brief A component that represents a drawable 2D shape using SFML.
+ * @class BaseApp
+ * @brief Application entry object: creates the window and the actors and runs the frame loop.
+ *
+ * By default the app opens an SFML window. A headless app renders into a
+ * NullRenderBackend for a fixed number of frames and prints the render counters on exit.
+ * Every frame is timed by the Profiler; setProfileOutput() also writes a Chrome trace and
+ * prints the per-zone percentiles when the loop ends.
+ *
+ * setRecordOutput() writes every frame's events, delta time and seed to a frame log, and
+ * setReplay() runs a log again headless, as fast as possible and with the same inputs,
+ * so a recorded session can be profiled or benchmarked frame for frame.
  *
- * Supports circle, rectangle, triangle, and polygon shapes.
+ * setOverlayEnabled() shows the window's stats overlay from the first frame (F3 toggles
+ * it at run time) and setTelemetryOutput() streams its counters to a CSV or JSON Lines file.
  */
-class CShape : public Component {
+class
+    BaseApp {
 public:
-  /**
-   * @brief Default constructor.
-   */
-  CShape();
-
-  CShape(ShapeType shapeType);
-
-  /**
-   * @brief Destructor.
-   */
-  virtual ~CShape() = default;
-
-  // M�todos de ciclo de vida
-  void start() override;
-  void update(float deltaTime) override;
-  void render(const EngineUtilities::TSharedPointer<Window>& window) override;
-  void destroy() override;
-
-  // Creaci�n y manipulaci�n de forma
-  void createShape(ShapeType shapeType);
-  void setPosition(float x, float y);
-  void setPosition(const sf::Vector2f& position);
-  void setFillColor(const sf::Color& color);
-  void SetRotation(float angle);
-  void setScale(const sf::Vector2f& scl);
+    BaseApp() = default;
+
+    ~BaseApp() = default;
+
+    /**
+     * @brief Runs the application until the window closes.
+     *
+     * @return Exit status of the application.
+     */
+    int
+        run();
+
+    /**
+     * @brief Renders into a NullRenderBackend instead of an SFML window.
+     *
+     * Must be called before run().
+     *
+     * @param maxFrames Number of frames to run before the loop ends.
+     */
+    void
+        setHeadless(uint64_t maxFrames);
+
+    /**
+     * @brief Captures profiler zones and writes them to @p tracePath when run() ends.
+     *
+     * The trace opens in chrome://tracing or Perfetto. An empty path disables the capture.
+     *
+     * @param tracePath Path of the Chrome trace JSON file.
+     */
+    void
+        setProfileOutput(const std::string& tracePath);
+
+    /**
+     * @brief Records every frame to a frame log.
+     *
+     * @param logPath Path of the log to create.
+     * @return false if the log cannot be created.
+     */
+    bool
+        setRecordOutput(const std::string& logPath);
+
+    /**
+     * @brief Replays a recorded session: runs headless for as many frames as the log
+     * has, feeding each frame its recorded events, delta time and seed.
+     *
+     * Must be called before run().
+     */
+    void
+        setReplay(const FrameReplay& replay);
+
+    /**
+     * @brief Shows the stats overlay from the first frame.
+     *
+     * Must be called before run().
+     */
+    void
+        setOverlayEnabled(bool enabled);
+
+    /**
+     * @brief Streams the window's telemetry counters to a file every frame: JSON Lines
+     * when the path ends in .json or .jsonl, CSV otherwise.
+     *
+     * Must be called before run(). An empty path disables the stream.
+     */
+    void
+        setTelemetryOutput(const std::string& path);
+
+    /**
+     * @brief Creates the window and the actors.
+     *
+     * @return true on success.
+     */
+    bool
+        init();
+
+    /**
+     * @brief Runs one iteration of the frame loop: events, update and render.
+     *
+     * run() calls it until the window closes; it is public so benchmarks can drive an
+     * initialized app without the reporting of run().
+     *
+     * @return false once the window is closed.
+     */
+    bool
+        runFrame();
+
+    /**
+     * @brief Per-frame logic.
+     *
+     * @param deltaTime Seconds since the previous frame, or the recorded value in a replay.
+     */
+    void
+        update(float deltaTime);
+
+    /**
+     * @brief Per-frame rendering.
+     */
+    void
+        render();
+
+    /**
+     * @brief Releases the application resources.
+     */
+    void
+        destroy();
+
+    /**
+     * @brief Asset cache of the app. update() finishes its loads every frame.
+     */
+    AssetManager&
+        getAssets() { return m_assets; }
+
+    /**
+     * @brief Scheduler of the coroutine behaviours. update() resumes it every frame with
+     * the frame's delta time, so behaviours replay exactly.
+     */
+    BehaviourScheduler&
+        getBehaviours() { return m_behaviours; }
+
+    /**
+     * @brief Tweens of the app. update() advances them after the behaviours, so a
+     * behaviour can start a tween and see it applied in the same frame.
+     */
+    TweenSystem&
+        getTweens() { return m_tweens; }
+
+    /**
+     * @brief Actors of the app by name. init() registers the demo actor.
+     */
+    EntityNameIndex&
+        getActorNames() { return m_actorNames; }
+
+    /**
+     * @brief Seed of the current frame. Derive gameplay randomness from it so replays
+     * reproduce it, as update() does for the demo actor's CParticleEmitter::reseed().
+     */
+    uint64_t
+        getFrameSeed() const { return m_frameSeed; }
 
 private:
-  EngineUtilities::TSharedPointer<sf::Shape> m_shapePtr; ///< Smart pointer a la forma SFML.
-  ShapeType m_shapeType = ShapeType::EMPTY;              ///< Tipo de forma actual.
-  sf::VertexArray* m_line = nullptr;                     ///< (opcional) l�nea si decides usar v�rtices.
-};
\ No newline at end of file
+    bool m_headless = false;          ///< Whether the app runs on a NullRenderBackend.
+    uint64_t m_headlessFrames = 0;    ///< Frames to run when headless.
+    std::string m_profilePath;        ///< Chrome trace written at the end of run(), empty for none.
+    FrameRecorder m_recorder;         ///< Frame log being written, if recording.
+    FrameReplay m_replay;             ///< Frame log being replayed.
+    bool m_replaying = false;         ///< Whether the frames come from m_replay.
+    std::size_t m_replayFrame = 0;    ///< Next frame of m_replay.
+    uint64_t m_frameSeed = 0;         ///< Random seed of the current frame.
+    std::chrono::steady_clock::time_point m_lastFrameTime; ///< Start of the previous frame.
+    std::vector<sf::Event> m_frameEvents; ///< Events of the frame, copied for the recorder.
+    bool m_overlayEnabled = false;    ///< Overlay shown when the window is created.
+    std::string m_telemetryPath;      ///< Telemetry stream opened by init(), empty for none.
+    NullRenderBackend* m_headlessBackend = nullptr; ///< Backend of a headless window, owned by it.
+
+    EngineUtilities::TSharedPointer<Window> m_windowPtr;   ///< Window the app renders into.
+    AssetManager m_assets;                                 ///< Loads and caches the app's files.
+    BehaviourScheduler m_behaviours;                       ///< Resumes coroutine behaviours; outlives the actors.
+    TweenSystem m_tweens;                                  ///< Animates transforms and shape colors in batches.
+    TransformSync m_transformSync;                         ///< Pushes changed transforms into render data.
+    EntityNameIndex m_actorNames;                          ///< Finds actors by interned name.
+    EngineUtilities::TSharedPointer<Actor> m_circleActor;  ///< Demo actor.
+};
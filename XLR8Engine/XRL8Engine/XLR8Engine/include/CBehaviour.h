@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file CBehaviour.h
+ * @brief Declares the CBehaviour component, which runs an entity's coroutine behaviours.
+ */
+
+#include "Prerequisites.h"
+#include "ECS/Component.h"
+#include "Core/BehaviourScheduler.h"
+
+class Window;
+
+/**
+ * @class CBehaviour
+ * @brief A component that owns coroutine behaviours running on a BehaviourScheduler.
+ *
+ * Scripted logic is written as straight-line coroutines instead of a state machine in
+ * update(). The behaviours live in the scheduler, which resumes them only when their wait
+ * is over; the component just stops them when it is destroyed.
+ */
+class CBehaviour : public TComponent<CBehaviour> {
+public:
+	/**
+	 * @brief Constructs a component whose behaviours run on @p scheduler, which must
+	 * outlive it.
+	 */
+	CBehaviour(BehaviourScheduler& scheduler);
+
+	/**
+	 * @brief Destructor. Stops the behaviours that are still running.
+	 */
+	virtual ~CBehaviour();
+
+	// Metodos de ciclo de vida
+	void destroy() override;
+
+	/**
+	 * @brief Starts a behaviour owned by this component. It runs up to its first co_await
+	 * before the call returns.
+	 *
+	 * @return ID of the behaviour, or 0 if it already finished.
+	 */
+	BehaviourId run(BehaviourTask task);
+
+	/**
+	 * @brief Stops every behaviour of the component.
+	 */
+	void stopAll();
+
+	/**
+	 * @brief Behaviours of the component that are still running.
+	 */
+	std::size_t getRunningCount() const;
+
+	BehaviourScheduler& getScheduler() { return *m_scheduler; }
+
+private:
+	BehaviourScheduler* m_scheduler;       ///< Scheduler que reanuda las corrutinas.
+	std::vector<BehaviourId> m_behaviours; ///< Corrutinas iniciadas por el componente.
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+/**
+ * @file CParticleEmitter.h
+ * @brief Declares the CParticleEmitter component, which spawns particles into a shared ParticleSystem.
+ */
+
+#include "Prerequisites.h"
+#include "ECS/Component.h"
+#include "Render/ParticleSystem.h"
+
+class Window;
+
+/**
+ * @struct ParticleEmitterSettings
+ * @brief Ranges the emitter draws each new particle from.
+ */
+struct
+	ParticleEmitterSettings {
+	float rate = 100.f;          ///< Particulas por segundo.
+	float lifetimeMin = 0.5f;    ///< Vida minima en segundos.
+	float lifetimeMax = 1.5f;    ///< Vida maxima en segundos.
+	float speedMin = 20.f;       ///< Rapidez minima.
+	float speedMax = 80.f;       ///< Rapidez maxima.
+	float direction = -90.f;     ///< Direccion central en grados; -90 apunta hacia arriba.
+	float spread = 360.f;        ///< Apertura del cono en grados.
+	float sizeMin = 2.f;         ///< Tamano minimo.
+	float sizeMax = 4.f;         ///< Tamano maximo.
+	sf::Color color = sf::Color::White; ///< Color inicial.
+};
+
+/**
+ * @class CParticleEmitter
+ * @brief A component that spawns particles at its world transform.
+ *
+ * Emitters do not own particles: every emitter feeds a shared ParticleSystem, so all
+ * particles of a scene are simulated and drawn as one SoA batch. The world transform is
+ * render data a TransformSync can drive, which also rotates the emission cone.
+ */
+class CParticleEmitter : public TComponent<CParticleEmitter> {
+public:
+	/**
+	 * @brief Default constructor. The emitter spawns nothing until a system is set.
+	 */
+	CParticleEmitter();
+
+	/**
+	 * @brief Constructs an emitter feeding a particle system.
+	 *
+	 * @param system System that receives the particles.
+	 * @param settings Emission rate and particle ranges.
+	 */
+	CParticleEmitter(const EngineUtilities::TSharedPointer<ParticleSystem>& system,
+		const ParticleEmitterSettings& settings = ParticleEmitterSettings());
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~CParticleEmitter() = default;
+
+	// Metodos de ciclo de vida
+	void update(float deltaTime) override;
+
+	/**
+	 * @brief Spawns @p count particles at once, independent of the rate.
+	 */
+	void burst(std::size_t count);
+
+	void setSystem(const EngineUtilities::TSharedPointer<ParticleSystem>& system) { m_system = system; }
+	void setSettings(const ParticleEmitterSettings& settings) { m_settings = settings; }
+	const ParticleEmitterSettings& getSettings() const { return m_settings; }
+
+	/**
+	 * @brief Pauses or resumes the continuous emission. burst() still works while paused.
+	 */
+	void setEmitting(bool emitting) { m_emitting = emitting; }
+	bool isEmitting() const { return m_emitting; }
+
+	/**
+	 * @brief Restarts the random sequence from a frame seed and the emitter ID.
+	 *
+	 * Call it each frame with BaseApp::getFrameSeed() before the emitter updates, so a
+	 * replay spawns the same particles as the recorded session.
+	 */
+	void reseed(uint64_t frameSeed);
+
+	/**
+	 * @brief Sets the ID mixed into reseed(). Emitters get increasing IDs as they are
+	 * created; set one explicitly when the creation order can differ between runs.
+	 */
+	void setEmitterId(uint32_t id) { m_emitterId = id; }
+	uint32_t getEmitterId() const { return m_emitterId; }
+
+	/**
+	 * @brief Moves the emitter. Overwritten by TransformSync when bound.
+	 */
+	void setPosition(const sf::Vector2f& position);
+
+	/**
+	 * @brief World matrix of the emitter, the render data a TransformSync writes into.
+	 */
+	sf::Transform& getRenderTransform() { return m_transform; }
+
+private:
+	/**
+	 * @brief Returns a uniform random value in [min, max].
+	 */
+	float random(float min, float max);
+
+	EngineUtilities::TSharedPointer<ParticleSystem> m_system; ///< Sistema que recibe las particulas.
+	ParticleEmitterSettings m_settings;                       ///< Parametros de emision.
+	sf::Transform m_transform;                                ///< Matriz de mundo del emisor.
+	float m_accumulator = 0.f;                                ///< Particulas pendientes de la tasa.
+	bool m_emitting = true;                                   ///< Emision continua activa.
+	uint32_t m_emitterId;                                     ///< Distingue emisores con la misma semilla.
+	uint32_t m_random;                                        ///< Estado del generador xorshift.
+	std::vector<float> m_angles;                              ///< Angulos de la rafaga actual.
+	std::vector<float> m_sines;
+	std::vector<float> m_cosines;
+};
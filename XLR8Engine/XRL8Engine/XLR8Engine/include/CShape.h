@@ -7,6 +7,8 @@
 
 #include "Prerequisites.h"
 #include "ECS/Component.h"
+#include "Render/RenderQueue.h"
+#include "Render/Tessellation.h"
 
 class Window;
 
@@ -14,9 +16,12 @@ class Window;
  * @class CShape
  * @brief A component that represents a drawable 2D shape using SFML.
  *
- * Supports circle, rectangle, triangle, and polygon shapes.
+ * Supports circle, rectangle, triangle, and polygon shapes, including arbitrary concave
+ * polygons built with createPolygon(). Shapes are submitted to the window's RenderQueue as
+ * triangles, so shapes sharing a layer and blend mode are drawn in a single batch. Position, rotation and scale live in a transformable owned by the
+ * component, which a TransformSync can drive from the entity's Transform.
  */
-class CShape : public Component {
+class CShape : public TComponent<CShape> {
 public:
 	/**
 	 * @brief Default constructor.
@@ -31,21 +36,82 @@ public:
 	virtual ~CShape() = default;
 
 	// M?todos de ciclo de vida
-	void start() override;
-	void update(float deltaTime) override;
 	void render(const EngineUtilities::TSharedPointer<Window>& window) override;
-	void destroy() override;
 
 	// Creaci?n y manipulaci?n de forma
 	void createShape(ShapeType shapeType);
+
+	/**
+	 * @brief Creates a polygon from an arbitrary simple outline, convex or concave.
+	 *
+	 * The outline is triangulated through the shared TessellationCache, so every shape with
+	 * the same outline reuses one index buffer. CollisionWorld::addShape still treats the
+	 * outline as a convex collider, or as its bounding box past eight points.
+	 *
+	 * @param points Outline in local space, either winding. With fewer than three points an
+	 *        error is logged and the shape is left unchanged.
+	 */
+	void createPolygon(const std::vector<sf::Vector2f>& points);
 	void setPosition(float x, float y);
 	void setPosition(const sf::Vector2f& position);
 	void setFillColor(const sf::Color& color);
+
+	/**
+	 * @brief Fill color of the shape, or transparent before createShape().
+	 */
+	sf::Color getFillColor() const;
 	void SetRotation(float angle);
 	void setScale(const sf::Vector2f& scl);
 
+	// Orden de dibujo
+	/**
+	 * @brief Sets the draw layer. Higher layers are drawn on top of lower ones.
+	 */
+	void setLayer(uint8_t layer) { m_layer = layer; }
+
+	/**
+	 * @brief Sets the depth inside the layer. Lower depths are drawn first.
+	 */
+	void setDepth(float depth) { m_depth = depth; }
+
+	/**
+	 * @brief Sets the blend mode used to draw the shape.
+	 */
+	void setBlendType(BlendType blendType) { m_blendType = blendType; }
+
+	/**
+	 * @brief Type of the shape created by createShape().
+	 */
+	ShapeType getShapeType() const { return m_shapeType; }
+
+	/**
+	 * @brief Local geometry of the shape, or nullptr before createShape().
+	 */
+	const sf::Shape* getShape() const { return m_shapePtr.get(); }
+
+	/**
+	 * @brief World matrix of the shape, the render data a TransformSync writes into.
+	 */
+	sf::Transform& getRenderTransform() { return m_transform; }
+
+	/**
+	 * @brief Cached triangulation of a createPolygon() outline, or nullptr for presets.
+	 */
+	const PolygonMesh* getMesh() const { return m_mesh.get(); }
+
 private:
+	/**
+	 * @brief Rebuilds the render matrix after a position, rotation or scale setter.
+	 */
+	void updateTransform();
+
 	EngineUtilities::TSharedPointer<sf::Shape> m_shapePtr; ///< Smart pointer a la forma SFML.
+	EngineUtilities::TSharedPointer<PolygonMesh> m_mesh;   ///< Triangulacion compartida del contorno.
+	sf::Transformable m_transformable;                     ///< Posicion, rotacion y escala de la forma.
+	sf::Transform m_transform;                             ///< Matriz de mundo usada al dibujar.
 	ShapeType m_shapeType = ShapeType::EMPTY;              ///< Tipo de forma actual.
 	sf::VertexArray* m_line = nullptr;                     ///< (opcional) l?nea si decides usar v?rtices.
+	uint8_t m_layer = 0;                                   ///< Capa de dibujo.
+	float m_depth = 0.f;                                   ///< Profundidad dentro de la capa.
+	BlendType m_blendType = BLEND_ALPHA;                   ///< Modo de mezcla.
 };
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+/**
+ * @file CSprite.h
+ * @brief Declares the CSprite component, a textured quad that samples a TextureAtlas region.
+ */
+
+#include "Prerequisites.h"
+#include "ECS/Component.h"
+#include "Render/RenderQueue.h"
+#include "Render/TextureAtlas.h"
+
+class Window;
+
+/**
+ * @class CSprite
+ * @brief A component that draws an atlas region as a textured quad.
+ *
+ * Sprites submit two triangles to the window's RenderQueue with the page texture of their
+ * region, so every sprite packed into the same atlas page is drawn in one batch.
+ */
+class CSprite : public TComponent<CSprite> {
+public:
+	/**
+	 * @brief Default constructor. The sprite draws nothing until a region is set.
+	 */
+	CSprite();
+
+	/**
+	 * @brief Constructs a sprite showing an atlas region.
+	 *
+	 * @param region Region returned by TextureAtlas::getRegion or findRegion.
+	 */
+	CSprite(const AtlasRegion& region);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~CSprite() = default;
+
+	// Metodos de ciclo de vida
+	void render(const EngineUtilities::TSharedPointer<Window>& window) override;
+
+	// Manipulacion del sprite
+	void setRegion(const AtlasRegion& region);
+	void setPosition(float x, float y);
+	void setPosition(const sf::Vector2f& position);
+	void setColor(const sf::Color& color);
+	void SetRotation(float angle);
+	void setScale(const sf::Vector2f& scl);
+
+	// Orden de dibujo
+	void setLayer(uint8_t layer) { m_layer = layer; }
+	void setDepth(float depth) { m_depth = depth; }
+	void setBlendType(BlendType blendType) { m_blendType = blendType; }
+
+	/**
+	 * @brief World matrix of the sprite, the render data a TransformSync writes into.
+	 */
+	sf::Transform& getRenderTransform() { return m_transform; }
+
+private:
+	/**
+	 * @brief Rebuilds the render matrix after a position, rotation or scale setter.
+	 */
+	void updateTransform();
+
+	AtlasRegion m_region;                 ///< Region del atlas que se dibuja.
+	sf::Transformable m_transformable;    ///< Posicion, rotacion y escala del sprite.
+	sf::Transform m_transform;            ///< Matriz de mundo usada al dibujar.
+	sf::Color m_color = sf::Color::White; ///< Color que modula la textura.
+	uint8_t m_layer = 0;                  ///< Capa de dibujo.
+	float m_depth = 0.f;                  ///< Profundidad dentro de la capa.
+	BlendType m_blendType = BLEND_ALPHA;  ///< Modo de mezcla.
+};
@@ -0,0 +1,296 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <coroutine>
+
+/**
+ * @file BehaviourScheduler.h
+ * @brief Declares coroutine behaviours: the BehaviourTask coroutine type, its awaitables
+ * and the scheduler that resumes them.
+ *
+ * A behaviour is a function returning BehaviourTask that suspends with co_await:
+ * @code
+ * BehaviourTask blink(CShape& shape, BehaviourEventId hit) {
+ *     co_await WaitForEvent(hit);
+ *     for (int i = 0; i < 6; ++i) {
+ *         shape.setFillColor(i % 2 == 0 ? sf::Color::Red : sf::Color::Yellow);
+ *         co_await WaitSeconds(0.1f);
+ *     }
+ * }
+ * @endcode
+ * Parameters are copied into the coroutine frame, so pass references only to objects
+ * that outlive it.
+ */
+
+class BehaviourScheduler;
+
+/**
+ * @brief Identifies a behaviour started on a BehaviourScheduler. 0 is never a valid ID.
+ */
+typedef uint64_t BehaviourId;
+
+/**
+ * @brief Index of an event registered on a BehaviourScheduler.
+ */
+typedef uint32_t BehaviourEventId;
+
+/**
+ * @class BehaviourTask
+ * @brief Return type of a behaviour coroutine.
+ *
+ * The coroutine starts suspended; BehaviourScheduler::start() takes it over and runs it
+ * to its first co_await.
+ */
+class
+    BehaviourTask {
+public:
+    /**
+     * @struct promise_type
+     * @brief Coroutine promise. Remembers which scheduler slot runs the coroutine.
+     */
+    struct
+        promise_type {
+        BehaviourScheduler* scheduler = nullptr; ///< Scheduler que reanuda la corrutina.
+        uint32_t slot = 0;                       ///< Slot de la corrutina en el scheduler.
+
+        BehaviourTask
+            get_return_object() { return BehaviourTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        std::suspend_always
+            initial_suspend() noexcept { return {}; }
+
+        std::suspend_always
+            final_suspend() noexcept { return {}; }
+
+        void
+            return_void() {}
+
+        /**
+         * @brief Logs the exception; the behaviour then ends as if it had returned.
+         */
+        void
+            unhandled_exception();
+    };
+
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    BehaviourTask(BehaviourTask&& other) noexcept : m_handle(other.m_handle) { other.m_handle = nullptr; }
+
+    BehaviourTask(const BehaviourTask&) = delete;
+    BehaviourTask& operator=(const BehaviourTask&) = delete;
+
+    ~BehaviourTask() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+private:
+    friend class BehaviourScheduler;
+
+    explicit BehaviourTask(Handle handle) : m_handle(handle) {}
+
+    Handle m_handle; ///< Corrutina hasta que el scheduler la adopta.
+};
+
+/**
+ * @struct WaitSeconds
+ * @brief Suspends the behaviour until at least @p seconds of scheduler time have passed.
+ * Resumes in a later update() even for zero or negative durations.
+ */
+struct
+    WaitSeconds {
+    explicit WaitSeconds(float seconds) : seconds(seconds) {}
+
+    bool
+        await_ready() const noexcept { return false; }
+
+    void
+        await_suspend(BehaviourTask::Handle handle) const;
+
+    void
+        await_resume() const noexcept {}
+
+    float seconds; ///< Duracion de la espera.
+};
+
+/**
+ * @struct WaitNextFrame
+ * @brief Suspends the behaviour until the next update().
+ */
+struct
+    WaitNextFrame {
+    bool
+        await_ready() const noexcept { return false; }
+
+    void
+        await_suspend(BehaviourTask::Handle handle) const;
+
+    void
+        await_resume() const noexcept {}
+};
+
+/**
+ * @struct WaitForEvent
+ * @brief Suspends the behaviour until the event is signalled.
+ */
+struct
+    WaitForEvent {
+    explicit WaitForEvent(BehaviourEventId event) : event(event) {}
+
+    bool
+        await_ready() const noexcept { return false; }
+
+    void
+        await_suspend(BehaviourTask::Handle handle) const;
+
+    void
+        await_resume() const noexcept {}
+
+    BehaviourEventId event; ///< Evento esperado.
+};
+
+/**
+ * @class BehaviourScheduler
+ * @brief Owns suspended behaviours and resumes only those whose wait is over.
+ *
+ * Waiting behaviours sit in a timer heap, a next-frame list or an event's wait list, so
+ * update() touches nothing but the behaviours it resumes: an idle behaviour costs no
+ * work per frame. Behaviours woken during update(), by an event another behaviour
+ * signals, resume in the next update(), so two behaviours that keep signalling each
+ * other cannot stall a frame.
+ *
+ * Must be used from a single thread.
+ */
+class
+    BehaviourScheduler {
+public:
+    BehaviourScheduler() = default;
+
+    /**
+     * @brief Destroys every behaviour still suspended.
+     */
+    ~BehaviourScheduler();
+
+    BehaviourScheduler(const BehaviourScheduler&) = delete;
+    BehaviourScheduler& operator=(const BehaviourScheduler&) = delete;
+
+    /**
+     * @brief Takes over a behaviour and runs it up to its first co_await.
+     *
+     * @return ID of the behaviour, or 0 if it finished without suspending.
+     */
+    BehaviourId
+        start(BehaviourTask task);
+
+    /**
+     * @brief Destroys a behaviour wherever it waits. A behaviour stopped while it runs,
+     * by itself or by code it calls, is destroyed at its next co_await. Stale IDs are
+     * ignored.
+     */
+    void
+        stop(BehaviourId id);
+
+    /**
+     * @brief Whether the behaviour has neither finished nor been stopped.
+     */
+    bool
+        isRunning(BehaviourId id) const;
+
+    /**
+     * @brief Returns the ID of an event, creating it if the name is new.
+     */
+    BehaviourEventId
+        registerEvent(const std::string& name);
+
+    /**
+     * @brief Wakes every behaviour waiting for the event. They resume in the next update(),
+     * also when signalled from inside one.
+     */
+    void
+        signal(BehaviourEventId event);
+
+    /**
+     * @brief Advances the scheduler clock and resumes the behaviours whose wait is over.
+     *
+     * @param deltaTime Seconds since the previous update.
+     */
+    void
+        update(float deltaTime);
+
+    /**
+     * @brief Behaviours started and not yet finished.
+     */
+    std::size_t
+        getRunningCount() const { return m_running; }
+
+    /**
+     * @brief Seconds accumulated by update().
+     */
+    double
+        getTime() const { return m_time; }
+
+private:
+    friend struct WaitSeconds;
+    friend struct WaitNextFrame;
+    friend struct WaitForEvent;
+
+    static const uint32_t kNoEvent = 0xFFFFFFFFu; ///< Slot que no espera ningun evento.
+
+    /**
+     * @struct Slot
+     * @brief A behaviour owned by the scheduler.
+     */
+    struct
+        Slot {
+        BehaviourTask::Handle handle;       ///< Corrutina; nula si el slot esta libre.
+        uint32_t generation = 1;            ///< Invalida IDs de un slot reciclado.
+        uint32_t waitEvent = kNoEvent;      ///< Evento que espera, si espera uno.
+        bool resuming = false;              ///< Se esta ejecutando ahora mismo.
+        bool stopRequested = false;         ///< stop() llamado mientras se ejecutaba.
+    };
+
+    /**
+     * @struct Timer
+     * @brief Entry of the timer heap.
+     */
+    struct
+        Timer {
+        double wakeTime;  ///< Tiempo del scheduler al despertar.
+        BehaviourId id;   ///< Corrutina que espera.
+
+        bool
+            operator>(const Timer& other) const { return wakeTime > other.wakeTime; }
+    };
+
+    static BehaviourId
+        makeId(uint32_t slot, uint32_t generation) { return (static_cast<uint64_t>(generation) << 32) | slot; }
+
+    /**
+     * @brief Slot of a live behaviour, or nullptr for a stale ID.
+     */
+    Slot*
+        findSlot(BehaviourId id);
+
+    /**
+     * @brief Resumes a behaviour and releases its slot if it finished or was stopped.
+     */
+    void
+        resume(BehaviourId id);
+
+    /**
+     * @brief Destroys the coroutine of a slot and recycles the slot.
+     */
+    void
+        release(uint32_t slot);
+
+    std::vector<Slot> m_slots;                           ///< Corrutinas por slot.
+    std::vector<uint32_t> m_freeSlots;                   ///< Slots libres.
+    std::vector<Timer> m_timers;                         ///< Heap de esperas por tiempo.
+    std::vector<BehaviourId> m_nextFrame;                ///< Esperan al siguiente update.
+    std::vector<BehaviourId> m_ready;                    ///< Listas para reanudar.
+    std::vector<BehaviourId> m_resuming;                 ///< Reanudadas en el update en curso.
+    std::vector<std::vector<BehaviourId>> m_eventWaiters; ///< Esperas por evento.
+    std::vector<std::string> m_eventNames;               ///< Nombre de cada evento.
+    std::size_t m_running = 0;                           ///< Corrutinas vivas.
+    double m_time = 0.0;                                 ///< Reloj del scheduler.
+};
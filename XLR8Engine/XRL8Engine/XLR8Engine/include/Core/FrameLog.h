@@ -0,0 +1,116 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file FrameLog.h
+ * @brief Declares the frame log: a compact binary record of every frame's input events,
+ * delta time and random seed, written by FrameRecorder and read back by FrameReplay.
+ *
+ * File layout: the magic "XRPL", a uint32 version, then one record per frame:
+ *   flags     one byte; bit 0: a float32 delta time follows, otherwise it repeats the
+ *             previous frame's; bit 1: a uint64 seed follows, otherwise the seed is
+ *             FrameLog::nextSeed() of the previous one
+ *   events    varint count, then each event as a varint type and its fields
+ * Integers are varints (signed ones zigzag encoded) and floats are stored as their bits,
+ * so a replay reproduces the recorded values exactly.
+ */
+
+/**
+ * @struct ReplayFrame
+ * @brief Everything the frame loop consumed in one frame.
+ */
+struct
+    ReplayFrame {
+    float deltaTime = 0.f;         ///< Delta time passed to update().
+    uint64_t seed = 0;             ///< Seed of the frame's random numbers.
+    std::vector<sf::Event> events; ///< Window events, in arrival order.
+};
+
+namespace FrameLog {
+
+    /**
+     * @brief Seed of the frame after one with @p seed (splitmix64). A session that only
+     * advances its seed with this stores no seed after the first frame.
+     */
+    uint64_t
+        nextSeed(uint64_t seed);
+}
+
+/**
+ * @class FrameRecorder
+ * @brief Appends frames to a frame log.
+ */
+class
+    FrameRecorder {
+public:
+    FrameRecorder() = default;
+
+    ~FrameRecorder() { close(); }
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    /**
+     * @brief Creates the log file and writes its header.
+     *
+     * @return false if the file cannot be created.
+     */
+    bool
+        open(const std::string& path);
+
+    /**
+     * @brief Writes the remaining frames and closes the file.
+     */
+    void
+        close();
+
+    bool
+        isOpen() const { return m_file.is_open(); }
+
+    /**
+     * @brief Records one frame.
+     *
+     * @param deltaTime Delta time of the frame.
+     * @param seed Random seed of the frame.
+     * @param events First of the frame's events.
+     * @param eventCount Number of events.
+     */
+    void
+        recordFrame(float deltaTime, uint64_t seed, const sf::Event* events, std::size_t eventCount);
+
+    uint64_t
+        getFrameCount() const { return m_frameCount; }
+
+private:
+    std::ofstream m_file;          ///< Archivo de salida.
+    std::vector<uint8_t> m_buffer; ///< Frames codificados pendientes de escribir.
+    float m_lastDeltaTime = 0.f;   ///< Delta del frame anterior.
+    uint64_t m_lastSeed = 0;       ///< Semilla del frame anterior.
+    uint64_t m_frameCount = 0;     ///< Frames grabados.
+};
+
+/**
+ * @class FrameReplay
+ * @brief A frame log loaded in memory, so replaying it costs no I/O.
+ */
+class
+    FrameReplay {
+public:
+    /**
+     * @brief Reads and decodes a whole log.
+     *
+     * @return false if the file cannot be read or is not a valid log. A log cut short by
+     * a crash keeps its complete frames.
+     */
+    bool
+        load(const std::string& path);
+
+    std::size_t
+        getFrameCount() const { return m_frames.size(); }
+
+    const ReplayFrame&
+        getFrame(std::size_t index) const { return m_frames[index]; }
+
+private:
+    std::vector<ReplayFrame> m_frames; ///< Frames del log.
+};
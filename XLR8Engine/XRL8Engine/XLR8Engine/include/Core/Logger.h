@@ -0,0 +1,344 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file Logger.h
+ * @brief Declares the asynchronous Logger behind the MESSAGE, WARNING, ERROR and FATAL macros.
+ */
+
+/**
+ * @enum LogLevel
+ * @brief Severity of a log record.
+ */
+enum
+    LogLevel {
+    LOG_TRACE = 0,   ///< Very verbose tracing.
+    LOG_DEBUG = 1,   ///< Development diagnostics.
+    LOG_INFO = 2,    ///< Normal events, e.g. resource creation.
+    LOG_WARNING = 3, ///< Something unexpected that the engine recovered from.
+    LOG_ERROR = 4,   ///< A failed operation; the program keeps running.
+    LOG_FATAL = 5    ///< An unrecoverable error; the program exits after logging it.
+};
+
+/**
+ * @brief Lowest level compiled in. Calls below it are removed at compile time, arguments
+ * included. Define it before including this header to override the default.
+ */
+#ifndef XLR8_LOG_LEVEL
+#ifdef NDEBUG
+#define XLR8_LOG_LEVEL 2
+#else
+#define XLR8_LOG_LEVEL 1
+#endif
+#endif
+
+/**
+ * @struct LoggerStats
+ * @brief Counters of the Logger.
+ */
+struct
+    LoggerStats {
+    uint64_t written = 0;  ///< Records written to the sink.
+    uint64_t dropped = 0;  ///< Records lost because a thread queue was full.
+    std::size_t threads = 0; ///< Thread queues currently registered.
+};
+
+namespace LogDetail {
+
+    static constexpr std::size_t kInlineText = 64; ///< Largest char array copied into the record.
+
+    /**
+     * @struct Literal
+     * @brief Text that lives as long as the program, kept by pointer. Made by XLR8_LOG_LITERAL.
+     */
+    struct
+        Literal {
+        const char* text; ///< Literal de cadena.
+    };
+
+    inline std::ostream&
+        operator<<(std::ostream& os, const Literal& literal) { return os << literal.text; }
+
+    /**
+     * @struct InlineText
+     * @brief Copy of a small char array, stored inside the record.
+     */
+    template<std::size_t N>
+    struct
+        InlineText {
+        char text[N]; ///< Copia del arreglo; puede no terminar en nulo.
+
+        InlineText(const char(&source)[N]) { std::copy(source, source + N, text); }
+    };
+
+    template<std::size_t N>
+    std::ostream&
+        operator<<(std::ostream& os, const InlineText<N>& inlineText) {
+        return os.write(inlineText.text, std::find(inlineText.text, inlineText.text + N, '\0') - inlineText.text);
+    }
+
+    /**
+     * @brief Type a log argument is stored as until the writer formats it.
+     *
+     * Only text tagged as a Literal is kept by pointer. A char array cannot be told apart
+     * from a string literal, and the caller's buffer may be gone by the time the record is
+     * formatted, so small arrays are copied into the record and larger arrays and any
+     * other text into a std::string. Every other argument is copied by value.
+     */
+    template<typename T>
+    struct StoredArg {
+        using Decayed = typename std::decay<T>::type;
+        using type = typename std::conditional<std::is_convertible<Decayed, const char*>::value,
+            std::string, Decayed>::type;
+    };
+
+    template<std::size_t N>
+    struct StoredArg<const char(&)[N]> {
+        using type = typename std::conditional<(N <= kInlineText), InlineText<N>, std::string>::type;
+    };
+
+    template<std::size_t N>
+    struct StoredArg<char(&)[N]> : StoredArg<const char(&)[N]> {
+    };
+
+    /**
+     * @brief Streams every stored argument, then destroys the tuple in place.
+     */
+    template<typename Tuple, std::size_t... I>
+    void
+        formatTuple(std::ostream& os, Tuple& parts, std::index_sequence<I...>) {
+        using Expand = int[];
+        (void)Expand { 0, ((os << std::get<I>(parts)), 0)... };
+    }
+
+    template<typename Tuple>
+    void
+        formatAndDestroy(std::ostream& os, void* payload) {
+        Tuple* parts = static_cast<Tuple*>(payload);
+        formatTuple(os, *parts, std::make_index_sequence<std::tuple_size<Tuple>::value>());
+        parts->~Tuple();
+    }
+
+    /**
+     * @struct Record
+     * @brief One queued message: a header and the arguments, still unformatted.
+     */
+    struct
+        Record {
+        static constexpr std::size_t kSize = 256;     ///< Bytes per record.
+        static constexpr std::size_t kPayloadSize = kSize - 32; ///< Bytes left for the arguments.
+
+        void (*format)(std::ostream&, void*);         ///< Formats the payload and destroys it.
+        int64_t time;                                 ///< Nanoseconds since the logger started.
+        LogLevel level;                               ///< Severity.
+        uint32_t thread;                              ///< Index of the producing thread.
+        alignas(16) unsigned char payload[kPayloadSize]; ///< Tupla de argumentos.
+    };
+
+    /**
+     * @class ThreadQueue
+     * @brief Single producer, single consumer ring of records owned by one thread.
+     *
+     * The producing thread only writes m_head and the writer thread only writes m_tail,
+     * so neither side ever takes a lock.
+     */
+    class
+        ThreadQueue {
+    public:
+        static constexpr uint32_t kCapacity = 1024; ///< Records per thread, a power of two.
+
+        explicit ThreadQueue(uint32_t thread) : m_thread(thread), m_records(new Record[kCapacity]) {}
+
+        /**
+         * @brief Returns the slot to fill, or nullptr if the ring is full.
+         */
+        Record*
+            beginPush() {
+            const uint32_t head = m_head.load(std::memory_order_relaxed);
+            if (head - m_tail.load(std::memory_order_acquire) >= kCapacity) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            return &m_records[head & (kCapacity - 1)];
+        }
+
+        /**
+         * @brief Publishes the slot returned by beginPush().
+         */
+        void
+            endPush() {
+            m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Formats every published record into @p os. Writer thread only.
+         *
+         * @return Number of records formatted.
+         */
+        uint32_t
+            drain(std::ostream& os);
+
+        bool
+            isEmpty() const {
+            return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_relaxed);
+        }
+
+        uint64_t
+            takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+        uint32_t
+            getThread() const { return m_thread; }
+
+        std::atomic<bool> closed{ false }; ///< Set when the owning thread exits.
+
+    private:
+        uint32_t m_thread;                                ///< Indice del hilo productor.
+        std::unique_ptr<Record[]> m_records;              ///< Anillo de registros.
+        alignas(64) std::atomic<uint32_t> m_head{ 0 };    ///< Escrito solo por el productor.
+        alignas(64) std::atomic<uint32_t> m_tail{ 0 };    ///< Escrito solo por el escritor.
+        alignas(64) std::atomic<uint64_t> m_dropped{ 0 }; ///< Registros perdidos por cola llena.
+    };
+}
+
+/**
+ * @class Logger
+ * @brief Process-wide asynchronous logger.
+ *
+ * A log call copies its arguments into a record of the calling thread's own queue and
+ * returns; it never locks, formats or touches I/O. A background writer thread drains every
+ * queue a few hundred times per second, formats the records and writes them to the sink in
+ * one batch. If a thread logs faster than the writer drains, its newest records are dropped
+ * and counted rather than stalling the caller.
+ *
+ * Records of one thread keep their order; records of different threads are written per
+ * queue, each one stamped with its time and thread index.
+ */
+class
+    Logger {
+public:
+    /**
+     * @brief The logger instance. The writer thread starts on first use.
+     */
+    static Logger&
+        get();
+
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief Queues a record. Every argument must be streamable to std::ostream.
+     *
+     * Prefer the macros, which also apply the compile-time level filter.
+     */
+    template<typename... Args>
+    void
+        write(LogLevel level, Args&&... args);
+
+    /**
+     * @brief Blocks until every record queued before the call has been written.
+     */
+    void
+        flush();
+
+    /**
+     * @brief Writes to a file instead of std::cerr. An empty path restores std::cerr.
+     *
+     * @return false if the file could not be opened; the sink is then unchanged.
+     */
+    bool
+        setOutputFile(const std::string& path);
+
+    LoggerStats
+        getStats() const;
+
+private:
+    Logger();
+
+    /**
+     * @brief Queue of the calling thread, registered on its first log call.
+     */
+    LogDetail::ThreadQueue&
+        threadQueue();
+
+    /**
+     * @brief Body of the writer thread.
+     */
+    void
+        run();
+
+    /**
+     * @brief Drains every queue into the sink. Requires m_mutex.
+     */
+    void
+        drainAll();
+
+    std::chrono::steady_clock::time_point m_start;   ///< Origen de las marcas de tiempo.
+    mutable std::mutex m_mutex;                      ///< Protege colas, salida y contadores.
+    std::condition_variable m_wake;                  ///< Despierta al escritor.
+    std::condition_variable m_flushed;               ///< Avisa el fin de un vaciado pedido.
+    std::vector<std::shared_ptr<LogDetail::ThreadQueue>> m_queues; ///< Una cola por hilo.
+    std::ofstream m_file;                            ///< Archivo de salida opcional.
+    std::ostringstream m_text;                       ///< Texto formateado de un vaciado.
+    uint64_t m_flushRequests = 0;                    ///< Vaciados pedidos por flush().
+    uint64_t m_flushesDone = 0;                      ///< Vaciados completados.
+    uint32_t m_nextThread = 0;                       ///< Indice del proximo hilo registrado.
+    LoggerStats m_stats;                             ///< Contadores.
+    bool m_running = true;                           ///< false al destruir el logger.
+    std::thread m_writer;                            ///< Hilo escritor.
+};
+
+template<typename... Args>
+void
+Logger::write(LogLevel level, Args&&... args) {
+    using Payload = std::tuple<typename LogDetail::StoredArg<Args&&>::type...>;
+    static_assert(sizeof(Payload) <= LogDetail::Record::kPayloadSize, "Log record arguments are too large");
+    static_assert(alignof(Payload) <= 16, "Log record arguments are over-aligned");
+
+    LogDetail::ThreadQueue& queue = threadQueue();
+    LogDetail::Record* record = queue.beginPush();
+    if (record == nullptr) {
+        return;
+    }
+
+    new (record->payload) Payload(std::forward<Args>(args)...);
+    record->format = &LogDetail::formatAndDestroy<Payload>;
+    record->time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_start).count();
+    record->level = level;
+    record->thread = queue.getThread();
+    queue.endPush();
+}
+
+/**
+ * @brief Tags a string literal so the logger keeps it by pointer instead of copying it.
+ * Anything but a literal fails to compile.
+ */
+#define XLR8_LOG_LITERAL(text) LogDetail::Literal{ "" text }
+
+/**
+ * @brief Logs at @p level if it is compiled in. Arguments are streamed one after another.
+ */
+#define XLR8_LOG(level, ...)                                          \
+do {                                                                  \
+    if constexpr ((level) >= XLR8_LOG_LEVEL) {                        \
+        Logger::get().write((level), __VA_ARGS__);                    \
+    }                                                                 \
+} while (0)
@@ -0,0 +1,108 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <deque>
+#include <mutex>
+
+/**
+ * @file NameTable.h
+ * @brief Declares the global string interning table behind entity names.
+ */
+
+/**
+ * @brief Interned name. Equal strings share one ID, so names compare as integers.
+ * 0 is the empty name.
+ */
+typedef uint32_t NameId;
+
+/**
+ * @class NameTable
+ * @brief Interns strings into 32-bit IDs with their hash computed once.
+ *
+ * Every string is stored once, next to its FNV-1a hash, and looked up by an
+ * open-addressing table of IDs that compares hashes before strings. Growing the table
+ * reuses the stored hashes instead of hashing the strings again. Interned strings are
+ * never released, so IDs and the references getString() returns stay valid for the
+ * whole program.
+ *
+ * All methods are thread-safe.
+ */
+class
+    NameTable {
+public:
+    static constexpr NameId kNoName = 0; ///< ID of the empty name.
+
+    /**
+     * @brief The name table instance.
+     */
+    static NameTable&
+        get();
+
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+
+    /**
+     * @brief ID of @p name, adding it if it is new.
+     */
+    NameId
+        intern(const std::string& name);
+
+    /**
+     * @brief ID of @p name, or kNoName if it was never interned. Never adds it.
+     */
+    NameId
+        find(const std::string& name) const;
+
+    /**
+     * @brief String of an ID. Unknown IDs give the empty string.
+     */
+    const std::string&
+        getString(NameId id) const;
+
+    /**
+     * @brief Hash of the string of an ID, as returned by hashName().
+     */
+    uint32_t
+        getHash(NameId id) const;
+
+    /**
+     * @brief Number of names interned, the empty name included.
+     */
+    std::size_t
+        size() const;
+
+    /**
+     * @brief 32-bit FNV-1a hash of a string.
+     */
+    static uint32_t
+        hashName(const std::string& name);
+
+private:
+    NameTable();
+
+    /**
+     * @struct Entry
+     * @brief An interned string.
+     */
+    struct
+        Entry {
+        std::string text; ///< Texto del nombre.
+        uint32_t hash;    ///< hashName() del texto.
+    };
+
+    /**
+     * @brief Bucket where @p name is, or the empty bucket where it would go. The caller
+     * holds the mutex.
+     */
+    std::size_t
+        findBucket(const std::string& name, uint32_t hash) const;
+
+    /**
+     * @brief Doubles the bucket table and reinserts every ID with its stored hash.
+     */
+    void
+        grow();
+
+    std::deque<Entry> m_entries;     ///< Nombres por ID; deque para no mover los strings.
+    std::vector<NameId> m_buckets;   ///< Tabla abierta de IDs, potencia de dos; 0 es vacio.
+    mutable std::mutex m_mutex;      ///< Protege la tabla entre hilos.
+};
@@ -0,0 +1,304 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file Profiler.h
+ * @brief Declares the frame Profiler and the XLR8_PROFILE_* instrumentation macros.
+ */
+
+/**
+ * @brief Set to 0 to compile every XLR8_PROFILE_* macro out.
+ */
+#ifndef XLR8_ENABLE_PROFILER
+#define XLR8_ENABLE_PROFILER 1
+#endif
+
+/**
+ * @struct ProfileEvent
+ * @brief One closed timing zone.
+ */
+struct
+    ProfileEvent {
+    const char* name;  ///< Nombre de la zona, un literal.
+    int64_t start;     ///< Inicio en nanosegundos desde que arranco el profiler.
+    int64_t end;       ///< Fin en nanosegundos.
+    uint32_t thread;   ///< Indice del hilo.
+    uint32_t depth;    ///< Zonas abiertas por encima en el mismo hilo.
+};
+
+/**
+ * @struct ZoneSummary
+ * @brief Per-frame statistics of one zone over the recorded frame history.
+ *
+ * A sample is the total time the zone took in one frame, all calls and threads summed.
+ * Frames in which the zone did not run are not samples.
+ */
+struct
+    ZoneSummary {
+    std::string name;        ///< Zone name.
+    std::size_t frames = 0;  ///< Frames in which the zone ran.
+    double callsPerFrame = 0.0; ///< Average calls in those frames.
+    double meanMs = 0.0;     ///< Mean time per frame.
+    double p50Ms = 0.0;      ///< Median.
+    double p90Ms = 0.0;      ///< 90th percentile.
+    double p99Ms = 0.0;      ///< 99th percentile.
+    double maxMs = 0.0;      ///< Slowest frame.
+};
+
+namespace ProfileDetail {
+
+    /**
+     * @class ThreadBuffer
+     * @brief Single producer, single consumer ring of closed zones owned by one thread.
+     */
+    class
+        ThreadBuffer {
+    public:
+        static constexpr uint32_t kCapacity = 1 << 14; ///< Zones per thread per frame, a power of two.
+
+        explicit ThreadBuffer(uint32_t thread) : m_thread(thread), m_events(new ProfileEvent[kCapacity]) {}
+
+        /**
+         * @brief Appends a zone, or counts it as dropped if the ring is full.
+         */
+        void
+            push(const char* name, int64_t start, int64_t end, uint32_t depth) {
+            const uint32_t head = m_head.load(std::memory_order_relaxed);
+            if (head - m_tail.load(std::memory_order_acquire) >= kCapacity) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            ProfileEvent& event = m_events[head & (kCapacity - 1)];
+            event.name = name;
+            event.start = start;
+            event.end = end;
+            event.thread = m_thread;
+            event.depth = depth;
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Moves every published zone to @p out. Consumer only.
+         */
+        void
+            drain(std::vector<ProfileEvent>& out);
+
+        uint64_t
+            takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+        bool
+            isEmpty() const {
+            return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_relaxed);
+        }
+
+        uint32_t depth = 0;                 ///< Zonas abiertas ahora; solo la toca el hilo dueno.
+        std::atomic<bool> closed{ false };  ///< Set when the owning thread exits.
+
+    private:
+        uint32_t m_thread;                                ///< Indice del hilo.
+        std::unique_ptr<ProfileEvent[]> m_events;         ///< Anillo de zonas.
+        alignas(64) std::atomic<uint32_t> m_head{ 0 };    ///< Escrito solo por el productor.
+        alignas(64) std::atomic<uint32_t> m_tail{ 0 };    ///< Escrito solo por el consumidor.
+        alignas(64) std::atomic<uint64_t> m_dropped{ 0 }; ///< Zonas perdidas por anillo lleno.
+    };
+}
+
+/**
+ * @class Profiler
+ * @brief Collects timing zones from every thread and aggregates them per frame.
+ *
+ * A ProfileScope reads the steady clock on entry and exit and appends the closed zone to
+ * its thread's own ring; recording never locks. endFrame(), called once per frame by the
+ * main loop, drains every ring, adds a "Frame" zone, sums each zone's time for the frame
+ * into a bounded history and, while capturing, keeps the raw zones for a Chrome trace.
+ *
+ * The trace is the Trace Event JSON format read by chrome://tracing and Perfetto.
+ */
+class
+    Profiler {
+public:
+    static constexpr std::size_t kHistoryFrames = 1024;     ///< Frames kept for the percentiles.
+    static constexpr std::size_t kMaxCapturedEvents = 1 << 22; ///< Trace event limit.
+
+    /**
+     * @brief The profiler instance.
+     */
+    static Profiler&
+        get();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * @brief Nanoseconds since the profiler started.
+     */
+    int64_t
+        now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    /**
+     * @brief Pauses or resumes recording. A paused profiler costs one atomic load per zone.
+     */
+    void
+        setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    bool
+        isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Keeps the raw zones of the following frames for writeChromeTrace().
+     */
+    void
+        setCapture(bool capture);
+
+    /**
+     * @brief Ring of the calling thread, registered on its first zone.
+     */
+    ProfileDetail::ThreadBuffer&
+        threadBuffer();
+
+    /**
+     * @brief Closes the current frame: collects the zones of every thread and aggregates them.
+     */
+    void
+        endFrame();
+
+    /**
+     * @brief Percentiles of every zone over the history, slowest mean first.
+     */
+    std::vector<ZoneSummary>
+        summarize() const;
+
+    /**
+     * @brief Prints summarize() as a table.
+     */
+    void
+        writeSummary(std::ostream& os) const;
+
+    /**
+     * @brief Writes the captured zones as Chrome trace JSON.
+     *
+     * @return false if the file could not be written.
+     */
+    bool
+        writeChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief Drops the history and the captured zones.
+     */
+    void
+        reset();
+
+    uint64_t
+        getFrameCount() const { return m_frameCount; }
+
+    uint64_t
+        getDroppedCount() const { return m_dropped; }
+
+private:
+    Profiler();
+
+    /**
+     * @brief Index of a zone name. Literals with the same text share one zone.
+     */
+    uint32_t
+        zoneIndex(const char* name);
+
+    /**
+     * @brief Per-frame totals of one zone, a ring of kHistoryFrames samples.
+     */
+    struct
+        ZoneHistory {
+        std::string name;                ///< Nombre de la zona.
+        std::vector<int64_t> samples;    ///< Nanosegundos por frame.
+        std::vector<uint32_t> calls;     ///< Llamadas por frame.
+        std::size_t next = 0;            ///< Proxima muestra a sobrescribir.
+        int64_t frameTotal = 0;          ///< Acumulado del frame en curso.
+        uint32_t frameCalls = 0;         ///< Llamadas del frame en curso.
+    };
+
+    std::chrono::steady_clock::time_point m_start;   ///< Origen de los tiempos.
+    std::atomic<bool> m_enabled{ true };             ///< Si se graban zonas.
+    mutable std::mutex m_mutex;                      ///< Protege el registro de hilos y el agregado.
+    std::vector<std::shared_ptr<ProfileDetail::ThreadBuffer>> m_buffers; ///< Un anillo por hilo.
+    std::vector<ProfileEvent> m_frameEvents;         ///< Zonas del frame que se cierra.
+    std::vector<ProfileEvent> m_captured;            ///< Zonas guardadas para la traza.
+    std::vector<ZoneHistory> m_zones;                ///< Historial por zona.
+    std::unordered_map<const char*, uint32_t> m_zoneByPointer; ///< Cache por puntero del literal.
+    std::unordered_map<std::string, uint32_t> m_zoneByName;    ///< Zona por texto.
+    std::vector<uint32_t> m_touched;                 ///< Zonas que corrieron en el frame.
+    int64_t m_frameStart = 0;                        ///< Inicio del frame en curso.
+    uint64_t m_frameCount = 0;                       ///< Frames cerrados.
+    uint64_t m_dropped = 0;                          ///< Zonas perdidas por anillos llenos.
+    uint32_t m_nextThread = 0;                       ///< Indice del proximo hilo registrado.
+    bool m_capture = false;                          ///< Si se guardan zonas para la traza.
+};
+
+/**
+ * @class ProfileScope
+ * @brief Times the enclosing scope as a zone. Use through XLR8_PROFILE_SCOPE.
+ */
+class
+    ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_name(name) {
+        Profiler& profiler = Profiler::get();
+        if (!profiler.isEnabled()) {
+            m_buffer = nullptr;
+            return;
+        }
+        m_buffer = &profiler.threadBuffer();
+        m_depth = m_buffer->depth++;
+        m_start = profiler.now();
+    }
+
+    ~ProfileScope() {
+        if (m_buffer != nullptr) {
+            m_buffer->push(m_name, m_start, Profiler::get().now(), m_depth);
+            m_buffer->depth--;
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;                      ///< Nombre de la zona.
+    ProfileDetail::ThreadBuffer* m_buffer;   ///< Anillo del hilo, nullptr si no se graba.
+    int64_t m_start = 0;                     ///< Inicio en nanosegundos.
+    uint32_t m_depth = 0;                    ///< Profundidad de anidamiento.
+};
+
+#define XLR8_PROFILE_CONCAT_(a, b) a##b
+#define XLR8_PROFILE_CONCAT(a, b) XLR8_PROFILE_CONCAT_(a, b)
+
+#if XLR8_ENABLE_PROFILER
+/**
+ * @brief Times the rest of the enclosing scope under @p name, a string literal.
+ */
+#define XLR8_PROFILE_SCOPE(name) ProfileScope XLR8_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+
+/**
+ * @brief Times the rest of the enclosing function under its name.
+ */
+#define XLR8_PROFILE_FUNCTION() XLR8_PROFILE_SCOPE(__FUNCTION__)
+
+/**
+ * @brief Closes the current frame. Called once per iteration of the main loop.
+ */
+#define XLR8_PROFILE_FRAME() Profiler::get().endFrame()
+#else
+#define XLR8_PROFILE_SCOPE(name) ((void)0)
+#define XLR8_PROFILE_FUNCTION() ((void)0)
+#define XLR8_PROFILE_FRAME() ((void)0)
+#endif
@@ -0,0 +1,180 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Render/RenderBackend.h"
+#include <array>
+#include <chrono>
+
+/**
+ * @file Telemetry.h
+ * @brief Declares the per-frame counters registry behind the stats overlay and the
+ * telemetry stream.
+ */
+
+#ifndef XLR8_TRACK_ALLOCATIONS
+/**
+ * @brief Counts heap allocations by replacing the global operator new. Costs one relaxed
+ * atomic increment per allocation; define it to 0 to remove.
+ */
+#define XLR8_TRACK_ALLOCATIONS 1
+#endif
+
+/**
+ * @brief Index of a counter in a Telemetry registry.
+ */
+typedef uint32_t CounterId;
+
+/**
+ * @enum TelemetryCounter
+ * @brief Counters every registry samples by itself in endFrame().
+ */
+enum
+    TelemetryCounter {
+    TELEMETRY_FRAME_MS = 0,    ///< Time since the previous endFrame(), in milliseconds.
+    TELEMETRY_ENTITIES = 1,    ///< Entities alive.
+    TELEMETRY_DRAW_CALLS = 2,  ///< Draw calls of the frame.
+    TELEMETRY_VERTICES = 3,    ///< Vertices submitted in the frame.
+    TELEMETRY_ALLOCATIONS = 4, ///< Heap allocations during the frame, every thread included.
+    TELEMETRY_JOB_QUEUE = 5,   ///< Tasks waiting in every ThreadPool.
+    TELEMETRY_BUILTIN_COUNT = 6
+};
+
+/**
+ * @struct FrameTimeStats
+ * @brief Percentiles of the recent frame times, in milliseconds.
+ */
+struct
+    FrameTimeStats {
+    double p50 = 0.0;     ///< Mediana.
+    double p90 = 0.0;     ///< Percentil 90.
+    double p99 = 0.0;     ///< Percentil 99.
+    double max = 0.0;     ///< Frame mas lento.
+    std::size_t frames = 0; ///< Frames en la ventana.
+};
+
+/**
+ * @class Telemetry
+ * @brief Registry of named per-frame counters with a frame time history.
+ *
+ * Game code registers counters and sets or adds to them during the frame; endFrame()
+ * samples the built-in counters, commits the frame, appends it to the stream file and
+ * clears the values for the next frame. While the registry is inactive, that is with no
+ * overlay and no stream, endFrame() returns at once and set()/add() only write a slot, so
+ * the counters cost next to nothing.
+ *
+ * A Telemetry belongs to one Window and must be used from the thread that drives it.
+ */
+class
+    Telemetry {
+public:
+    static constexpr std::size_t kHistory = 240; ///< Frame times kept for the percentiles.
+
+    Telemetry();
+
+    ~Telemetry();
+
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+
+    /**
+     * @brief Returns the ID of a counter, creating it if the name is new.
+     */
+    CounterId
+        registerCounter(const std::string& name);
+
+    /**
+     * @brief Sets a counter's value for the current frame.
+     */
+    void
+        set(CounterId counter, double value) { m_current[counter] = value; }
+
+    /**
+     * @brief Adds to a counter's value for the current frame.
+     */
+    void
+        add(CounterId counter, double value = 1.0) { m_current[counter] += value; }
+
+    /**
+     * @brief Samples every frame even without a stream, e.g. while the overlay is shown.
+     */
+    void
+        setEnabled(bool enabled) { m_enabled = enabled; }
+
+    /**
+     * @brief Whether endFrame() records anything.
+     */
+    bool
+        isActive() const { return m_enabled || m_stream.is_open(); }
+
+    /**
+     * @brief Streams every frame to a file: JSON Lines when the path ends in .json or
+     * .jsonl, CSV otherwise. Counters registered after the first frame is written are
+     * left out of a CSV stream.
+     *
+     * @return false if the file cannot be created.
+     */
+    bool
+        openStream(const std::string& path);
+
+    void
+        closeStream();
+
+    /**
+     * @brief Commits the current frame.
+     *
+     * @param renderStats Counters of the frame the window just presented.
+     */
+    void
+        endFrame(const RenderStats& renderStats);
+
+    /**
+     * @brief Value of a counter in the last committed frame.
+     */
+    double
+        getValue(CounterId counter) const { return m_last[counter]; }
+
+    std::size_t
+        getCounterCount() const { return m_names.size(); }
+
+    const std::string&
+        getCounterName(CounterId counter) const { return m_names[counter]; }
+
+    /**
+     * @brief Percentiles over the last kHistory frames.
+     */
+    FrameTimeStats
+        getFrameTimes() const;
+
+    /**
+     * @brief Frames committed since the registry was created.
+     */
+    uint64_t
+        getFrameCount() const { return m_frameCount; }
+
+    /**
+     * @brief Heap allocations since the program started, or 0 without XLR8_TRACK_ALLOCATIONS.
+     */
+    static uint64_t
+        getAllocationCount();
+
+private:
+    /**
+     * @brief Appends the last frame to the stream.
+     */
+    void
+        writeStreamRow();
+
+    std::vector<std::string> m_names;    ///< Nombre de cada contador.
+    std::vector<double> m_current;       ///< Valores del frame en curso.
+    std::vector<double> m_last;          ///< Valores del ultimo frame cerrado.
+    std::array<float, kHistory> m_frameTimes{}; ///< Historial circular de tiempos de frame.
+    std::size_t m_historyCount = 0;      ///< Entradas validas del historial.
+    uint64_t m_frameCount = 0;           ///< Frames cerrados.
+    bool m_enabled = false;              ///< Muestrea sin stream.
+    bool m_hasFrameStart = false;        ///< Si m_frameStart es valido.
+    std::chrono::steady_clock::time_point m_frameStart; ///< Fin del frame anterior.
+    uint64_t m_allocationsAtFrameStart = 0; ///< Contador global al empezar el frame.
+
+    std::ofstream m_stream;              ///< Archivo de telemetria.
+    bool m_streamJson = false;           ///< JSON Lines en vez de CSV.
+    std::size_t m_streamColumns = 0;     ///< Contadores en la cabecera CSV; 0 sin escribir.
+};
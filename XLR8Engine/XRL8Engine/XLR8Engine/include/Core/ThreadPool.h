@@ -0,0 +1,93 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * @file ThreadPool.h
+ * @brief Declares the ThreadPool that runs engine jobs and data-parallel loops on worker threads.
+ */
+
+ /**
+  * @class ThreadPool
+  * @brief Fixed set of worker threads fed from a shared task queue.
+  *
+  * parallelFor() splits an index range into chunks that the workers and the calling
+  * thread take from an atomic counter. It returns once every chunk has run, so the loop
+  * body may capture locals by reference. enqueue() runs fire-and-forget tasks.
+  */
+class
+    ThreadPool {
+public:
+    /**
+     * @brief Starts the workers.
+     *
+     * @param threadCount Number of worker threads. 0 uses one less than the hardware
+     * threads, since the caller of parallelFor() also works.
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+
+    /**
+     * @brief Runs the queued tasks to completion and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a task for a worker thread.
+     */
+    void
+        enqueue(std::function<void()> task);
+
+    /**
+     * @brief Calls body(begin, end) over [0, count) in chunks of at least @p grainSize indices.
+     *
+     * Chunks run concurrently and in no particular order. Blocks until all are done.
+     *
+     * @param count Number of indices.
+     * @param grainSize Minimum number of indices per chunk.
+     * @param body Function called with each half-open chunk.
+     */
+    void
+        parallelFor(std::size_t count, std::size_t grainSize,
+            const std::function<void(std::size_t, std::size_t)>& body);
+
+    /**
+     * @brief Blocks until the queue is empty and no worker is running a task.
+     */
+    void
+        waitIdle();
+
+    /**
+     * @brief Number of threads that run parallelFor() chunks, the caller included.
+     */
+    std::size_t
+        getThreadCount() const { return m_workers.size() + 1; }
+
+    /**
+     * @brief Tasks queued and not yet picked up, summed over every pool.
+     */
+    static std::size_t
+        getPendingTaskCount();
+
+private:
+    /**
+     * @brief Loop run by each worker: pops and runs tasks until shutdown.
+     */
+    void
+        workerLoop();
+
+    std::vector<std::thread> m_workers;          ///< Worker threads.
+    std::deque<std::function<void()>> m_tasks;   ///< Pending tasks.
+    std::mutex m_mutex;                          ///< Guards m_tasks, m_active and m_stop.
+    std::condition_variable m_taskReady;         ///< Signals new tasks or shutdown.
+    std::condition_variable m_idle;              ///< Signals that a task finished.
+    std::size_t m_active = 0;                    ///< Tasks being run.
+    bool m_stop = false;                         ///< Set by the destructor.
+};
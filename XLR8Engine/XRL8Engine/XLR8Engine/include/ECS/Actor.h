@@ -2,14 +2,29 @@
 #include "../Prerequisites.h"
 #include "Entity.h"
 #include "CShape.h"
+#include "CSprite.h"
+#include "CParticleEmitter.h"
 #include "Transform.h"
+#include "../Core/NameTable.h"
 
 class
     Actor : public Entity {
 public:
-    Actor() = default;
+    Actor() : m_name(NameTable::get().intern("Actor")) {}
     Actor(const std::string& actorName);
 
+    /**
+     * @brief Name of the actor, interned in the NameTable.
+     */
+    const std::string&
+        getName() const { return NameTable::get().getString(m_name); }
+
+    /**
+     * @brief Interned name, the key of an EntityNameIndex.
+     */
+    NameId
+        getNameId() const { return m_name; }
+
     virtual
         ~Actor() = default;
 
@@ -25,8 +40,16 @@ public:
     void
         destroy() override;
 
+    /**
+     * @brief Binds the actor's Transform to the render data of its CShape, CSprite or CParticleEmitter.
+     *
+     * @param sync Stage that pushes the transform into the render data when it changes.
+     */
+    void
+        bindTransform(TransformSync& sync);
+
 private:
-    std::string m_name = "Actor";
+    NameId m_name = NameTable::kNoName; ///< Nombre internado; 4 bytes por actor.
 
     template <typename T>
     inline EngineUtilities::TSharedPointer<T> getComponents() {
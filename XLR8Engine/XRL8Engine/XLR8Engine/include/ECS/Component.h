@@ -1,65 +1,168 @@
 #pragma once
 #include "../Prerequisites.h"
-#include "Component.h"
+#include <typeinfo>
 
-class window;
+class Window;
 
+/**
+ * @file Component.h
+ * @brief Declares the Component base class used by every ECS component.
+ */
+
+ /**
+  * @class Component
+  * @brief Base class for all components that can be attached to an Entity.
+  */
 class
-    Entity {
+    Component {
 public:
+    /**
+     * @brief Default constructor. The component type is left as NONE.
+     */
+    Component() = default;
 
+    /**
+     * @brief Constructs a component of the given type.
+     *
+     * @param type Type identifier of the component.
+     */
+    Component(const ComponentType type) : m_type(type) {}
 
     virtual
-        ~Entity() = default;
+        ~Component() = default;
 
     /**
-     * @brief Pure virtual method for initialization logic.
-     * @param deltaTime Time elapsed since last frame (used for time-dependent setup).
+     * @brief Initialization logic. Does nothing unless overridden.
      */
     virtual void
-        start() = 0;
+        start() {}
 
     /**
-     * @brief Pure virtual method for updating logic every frame.
+     * @brief Updating logic every frame. Does nothing unless overridden.
      * @param deltaTime Time elapsed since last frame.
      */
     virtual void
-        update(float deltaTime) = 0;
+        update(float deltaTime) {}
 
     /**
-     * @brief Pure virtual method for rendering the component.
+     * @brief Renders the component. Does nothing unless overridden.
      * @param window Smart pointer to the window where rendering occurs.
      */
     virtual void
-        render(const EngineUtilities::TSharedPointer<Window>& window) = 0;
+        render(const EngineUtilities::TSharedPointer<Window>& window) {}
 
     /**
-     * @brief Pure virtual method for cleaning up resources.
+     * @brief Cleans up resources. Does nothing unless overridden.
      */
     virtual void
-        destroy() = 0;
+        destroy() {}
+
+    /**
+     * @brief Lifecycle hooks this component has real work in, one bit per ComponentHook.
+     *
+     * Read once by Entity::addComponent. Components that do not derive from TComponent
+     * report every hook.
+     */
+    virtual uint32_t
+        getHookMask() const { return kAllHooks; }
+
+    /**
+     * @brief Returns the type of the component.
+     */
+    ComponentType
+        getType() const { return m_type; }
+
+    static const uint32_t kAllHooks = (1u << COMPONENT_HOOK_COUNT) - 1; ///< Todos los hooks.
+
+protected:
+    ComponentType m_type = ComponentType::NONE; ///< Type of the component.
+};
 
+/**
+ * @struct HookOwner
+ * @brief Class that declares the overload of a hook taking exactly @p Args.
+ *
+ * Deducing C from an overload set keeps only the members whose parameters are Args, so
+ * other overloads of the same name, such as a helper update(int), do not get in the way.
+ */
+template<typename... Args>
+struct
+    HookOwner {
+    template<typename C>
+    static C*
+        of(void (C::*)(Args...));
+};
 
-    template<typename T>
-    void addComponent(EngineUtilities::TSharedPointer<T> component) {
-        static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
-        components.push_back(component.template dynamic_pointer_cast<Component>());
+/**
+ * @struct ComponentHooks
+ * @brief Lifecycle hooks a component type overrides, found at compile time.
+ *
+ * &T::update, narrowed to the Component signature, belongs to Component unless T, or a
+ * base between T and Component, overrides it, so the class that owns it tells which
+ * hooks have real work. Overloading a hook name is supported. A hook only inherited from
+ * Component is left out of the mask and Entity never calls it. Component itself could be
+ * any type, so it gets every hook, and so does a hook whose owner cannot be deduced, for
+ * example next to a template overload.
+ */
+template<typename T>
+struct
+    ComponentHooks {
+    static constexpr bool
+        overridesStart() {
+        if constexpr (requires { HookOwner<>::of(&T::start); }) {
+            return !std::is_same<decltype(HookOwner<>::of(&T::start)), Component*>::value;
+        }
+        return true;
     }
 
-    template<typename T>
-    EngineUtilities::TSharedPointer<T>
-        getComponent() {
-        for (auto& component : components) {
-            EngineUtilities::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
-            if (specificComponent) {
-                return specificComponent;
-            }
+    static constexpr bool
+        overridesUpdate() {
+        if constexpr (requires { HookOwner<float>::of(&T::update); }) {
+            return !std::is_same<decltype(HookOwner<float>::of(&T::update)), Component*>::value;
         }
-        return EngineUtilities::TSharedPointer<T>();
+        return true;
     }
 
-protected:
-    bool isActive;
-    uint32_t id;
-    std::vector<EngineUtilities::TSharedPointer<Component>> components;
-};
\ No newline at end of file
+    static constexpr bool
+        overridesRender() {
+        typedef HookOwner<const EngineUtilities::TSharedPointer<Window>&> RenderOwner;
+        if constexpr (requires { RenderOwner::of(&T::render); }) {
+            return !std::is_same<decltype(RenderOwner::of(&T::render)), Component*>::value;
+        }
+        return true;
+    }
+
+    static constexpr bool
+        overridesDestroy() {
+        if constexpr (requires { HookOwner<>::of(&T::destroy); }) {
+            return !std::is_same<decltype(HookOwner<>::of(&T::destroy)), Component*>::value;
+        }
+        return true;
+    }
+
+    static const uint32_t mask = std::is_same<T, Component>::value ? Component::kAllHooks :
+        (overridesStart() ? 1u << HOOK_START : 0u) |
+        (overridesUpdate() ? 1u << HOOK_UPDATE : 0u) |
+        (overridesRender() ? 1u << HOOK_RENDER : 0u) |
+        (overridesDestroy() ? 1u << HOOK_DESTROY : 0u); ///< Un bit por ComponentHook.
+};
+
+/**
+ * @class TComponent
+ * @brief CRTP base that reports the hooks of the component's dynamic type.
+ *
+ * Derive a component from TComponent<Self> instead of Component. getHookMask() returns
+ * ComponentHooks<Self>::mask only when the object really is a Self; a subclass that does
+ * not derive from TComponent itself could override any hook, so it reports every hook.
+ */
+template<typename Derived>
+class
+    TComponent : public Component {
+public:
+    using Component::Component;
+
+    uint32_t
+        getHookMask() const override {
+        return typeid(*this) == typeid(Derived) ? ComponentHooks<Derived>::mask : kAllHooks;
+    }
+};
@@ -1,20 +1,36 @@
 #pragma once
 #include "../Prerequisites.h"
 #include "Component.h"
+#include <atomic>
 
-class window;
+class Window;
 
 class
     Entity {
 public:
+    Entity() { s_liveCount.fetch_add(1, std::memory_order_relaxed); }
 
+    Entity(const Entity& other)
+        : isActive(other.isActive), id(other.id), components(other.components) {
+        for (uint32_t hook = 0; hook < COMPONENT_HOOK_COUNT; ++hook) {
+            hookComponents[hook] = other.hookComponents[hook];
+        }
+        s_liveCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Entity& operator=(const Entity&) = default;
 
     virtual
-        ~Entity() = default;
+        ~Entity() { s_liveCount.fetch_sub(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of entities alive, read by the telemetry.
+     */
+    static uint64_t
+        getLiveCount() { return s_liveCount.load(std::memory_order_relaxed); }
 
     /**
      * @brief Pure virtual method for initialization logic.
-     * @param deltaTime Time elapsed since last frame (used for time-dependent setup).
      */
     virtual void
         start() = 0;
@@ -40,12 +56,34 @@ public:
         destroy() = 0;
 
 
+    /**
+     * @brief Attaches a component and lists it under the hooks its type overrides.
+     *
+     * The hooks come from Component::getHookMask() of the object itself, so a component
+     * added through a pointer to one of its bases is still listed under its own hooks.
+     */
     template<typename T>
     void addComponent(EngineUtilities::TSharedPointer<T> component) {
         static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
         components.push_back(component.template dynamic_pointer_cast<Component>());
+        Component* added = components.back().get();
+        if (added == nullptr) {
+            return;
+        }
+        const uint32_t mask = added->getHookMask();
+        for (uint32_t hook = 0; hook < COMPONENT_HOOK_COUNT; ++hook) {
+            if (mask & (1u << hook)) {
+                hookComponents[hook].push_back(added);
+            }
+        }
     }
 
+    /**
+     * @brief Components that override @p hook, in the order they were added.
+     */
+    const std::vector<Component*>&
+        getHookComponents(ComponentHook hook) const { return hookComponents[hook]; }
+
     template<typename T>
     EngineUtilities::TSharedPointer<T>
         getComponent() {
@@ -59,7 +97,11 @@ public:
     }
 
 protected:
-    bool isActive;
-    uint32_t id;
+    bool isActive = true;
+    uint32_t id = 0;
     std::vector<EngineUtilities::TSharedPointer<Component>> components;
+    std::vector<Component*> hookComponents[COMPONENT_HOOK_COUNT]; ///< Componentes con trabajo real por hook; los posee components.
+
+private:
+    static inline std::atomic<uint64_t> s_liveCount{ 0 }; ///< Entidades vivas.
 };
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Core/NameTable.h"
+
+/**
+ * @file EntityNameIndex.h
+ * @brief Declares the EntityNameIndex, which finds entities by interned name.
+ */
+
+class Entity;
+
+/**
+ * @class EntityNameIndex
+ * @brief Hash index from NameId to entity.
+ *
+ * Keys are interned IDs, so a lookup hashes one integer and compares integers; no
+ * string is hashed or compared after the name was interned. Entities are not owned:
+ * remove an entity before destroying it. Each name maps to one entity; adding a name
+ * already in the index fails.
+ *
+ * Must be used from a single thread.
+ */
+class
+    EntityNameIndex {
+public:
+    /**
+     * @brief Maps @p name to @p entity.
+     *
+     * @return false if the name is empty or already maps to an entity.
+     */
+    bool
+        add(NameId name, Entity* entity);
+
+    /**
+     * @brief Removes the name from the index. Unknown names are ignored.
+     */
+    void
+        remove(NameId name);
+
+    /**
+     * @brief Entity of a name, or nullptr.
+     */
+    Entity*
+        find(NameId name) const;
+
+    /**
+     * @brief Entity of a name given as a string, or nullptr. A string that was never
+     * interned is not added to the NameTable.
+     */
+    Entity*
+        find(const std::string& name) const { return find(NameTable::get().find(name)); }
+
+    /**
+     * @brief Removes every name.
+     */
+    void
+        clear();
+
+    /**
+     * @brief Number of names in the index.
+     */
+    std::size_t
+        size() const { return m_count; }
+
+private:
+    /**
+     * @struct Bucket
+     * @brief Slot of the open-addressing table.
+     */
+    struct
+        Bucket {
+        NameId name = NameTable::kNoName; ///< Clave; kNoName si esta vacio.
+        Entity* entity = nullptr;         ///< Entidad con ese nombre.
+    };
+
+    /**
+     * @brief First bucket probed for a name.
+     */
+    std::size_t
+        home(NameId name) const;
+
+    /**
+     * @brief Doubles the table and reinserts every entry.
+     */
+    void
+        grow();
+
+    std::vector<Bucket> m_buckets; ///< Potencia de dos, o vacio antes del primer add().
+    std::size_t m_count = 0;       ///< Nombres en el indice.
+};
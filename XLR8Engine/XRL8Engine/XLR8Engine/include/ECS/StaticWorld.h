@@ -0,0 +1,293 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @file StaticWorld.h
+ * @brief Declares StaticWorld, an ECS whose component set is fixed at compile time.
+ */
+
+/**
+ * @brief Identifies an entity of a StaticWorld. 0 is never a valid ID.
+ */
+typedef uint64_t StaticEntity;
+
+/**
+ * @class StaticWorld
+ * @brief Entities whose components are drawn from a type list known at compile time.
+ *
+ * Meant for fixed-schema simulation, next to the dynamic Entity/Component model used by
+ * tooling. Each component type gets its own array indexed by entity slot, so get<T>()
+ * is one array access; the type's position in @p Components is resolved by the compiler,
+ * and a per-entity bit mask says which components are present. There are no virtual
+ * calls, no dynamic_cast and no type erasure anywhere: systems are plain objects whose
+ * update() the world calls directly.
+ *
+ * Components are stored by value and must be default constructible. Arrays grow with the
+ * highest slot used, so every entity costs one element of every component type; the
+ * world fits schemas where most entities share most components.
+ *
+ * @code
+ * struct Position { float x, y; };
+ * struct Velocity { float x, y; };
+ * struct Movement {
+ *     template<typename World>
+ *     void update(World& world, float deltaTime) {
+ *         world.template each<Position, Velocity>([deltaTime](Position& p, Velocity& v) {
+ *             p.x += v.x * deltaTime;
+ *             p.y += v.y * deltaTime;
+ *         });
+ *     }
+ * };
+ *
+ * StaticWorld<Position, Velocity> world;
+ * StaticEntity entity = world.create();
+ * world.add(entity, Position{ 0.f, 0.f });
+ * world.add(entity, Velocity{ 1.f, 0.f });
+ * Movement movement;
+ * world.update(1.f / 60.f, movement);
+ * @endcode
+ */
+template<typename... Components>
+class
+    StaticWorld {
+    static_assert(sizeof...(Components) > 0, "StaticWorld needs at least one component type");
+    static_assert(sizeof...(Components) <= 64, "StaticWorld supports up to 64 component types");
+
+public:
+    typedef uint64_t Mask; ///< Un bit por tipo de componente.
+
+    /**
+     * @brief Position of @p T in the component list.
+     */
+    template<typename T>
+    static constexpr std::size_t
+        indexOf() {
+        constexpr bool matches[] = { std::is_same<T, Components>::value... };
+        for (std::size_t i = 0; i < sizeof...(Components); ++i) {
+            if (matches[i]) {
+                return i;
+            }
+        }
+        return sizeof...(Components);
+    }
+
+    /**
+     * @brief Mask bits of the component types @p Ts.
+     */
+    template<typename... Ts>
+    static constexpr Mask
+        maskOf() { return (Mask(0) | ... | (Mask(1) << checkedIndex<Ts>())); }
+
+    /**
+     * @brief Creates an entity with no components.
+     */
+    StaticEntity
+        create() {
+        uint32_t slot;
+        if (!m_freeSlots.empty()) {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else {
+            slot = static_cast<uint32_t>(m_masks.size());
+            m_masks.push_back(0);
+            m_generations.push_back(1);
+            std::apply([](auto&... arrays) { (arrays.emplace_back(), ...); }, m_storage);
+        }
+        m_alive++;
+        return makeId(slot, m_generations[slot]);
+    }
+
+    /**
+     * @brief Destroys an entity and its components. Stale IDs are ignored.
+     *
+     * The components are reset to T() at once, so resources they hold are freed now
+     * rather than when the slot is reused.
+     */
+    void
+        destroy(StaticEntity entity) {
+        if (!isAlive(entity)) {
+            return;
+        }
+        const uint32_t slot = static_cast<uint32_t>(entity);
+        resetSlot(slot);
+        m_generations[slot]++;
+        m_freeSlots.push_back(slot);
+        m_alive--;
+    }
+
+    /**
+     * @brief Whether the entity has not been destroyed.
+     */
+    bool
+        isAlive(StaticEntity entity) const {
+        const uint32_t slot = static_cast<uint32_t>(entity);
+        return slot < m_generations.size() && m_generations[slot] == static_cast<uint32_t>(entity >> 32);
+    }
+
+    /**
+     * @brief Gives the entity a component, replacing the one it may already have.
+     *
+     * @return The stored component, valid until the next create().
+     */
+    template<typename T>
+    T&
+        add(StaticEntity entity, T component = T()) {
+        const uint32_t slot = checkedSlot(entity);
+        m_masks[slot] |= maskOf<T>();
+        T& stored = array<T>()[slot];
+        stored = std::move(component);
+        return stored;
+    }
+
+    /**
+     * @brief Takes a component away from the entity.
+     */
+    template<typename T>
+    void
+        remove(StaticEntity entity) {
+        if (isAlive(entity)) {
+            m_masks[static_cast<uint32_t>(entity)] &= ~maskOf<T>();
+        }
+    }
+
+    /**
+     * @brief Whether the entity is alive and has every component in @p Ts.
+     */
+    template<typename... Ts>
+    bool
+        has(StaticEntity entity) const {
+        constexpr Mask required = maskOf<Ts...>();
+        return isAlive(entity) && (m_masks[static_cast<uint32_t>(entity)] & required) == required;
+    }
+
+    /**
+     * @brief Component of a live entity. The entity must have it; use has() when unsure.
+     */
+    template<typename T>
+    T&
+        get(StaticEntity entity) { return array<T>()[static_cast<uint32_t>(entity)]; }
+
+    template<typename T>
+    const T&
+        get(StaticEntity entity) const { return array<T>()[static_cast<uint32_t>(entity)]; }
+
+    /**
+     * @brief Calls @p function for every entity that has all of @p Ts.
+     *
+     * @p function takes (Ts&...) or (StaticEntity, Ts&...). It may destroy entities or
+     * remove components, but must not create entities: that can grow the arrays under
+     * the references it was given.
+     */
+    template<typename... Ts, typename Function>
+    void
+        each(Function&& function) {
+        constexpr Mask required = maskOf<Ts...>();
+        const uint32_t count = static_cast<uint32_t>(m_masks.size());
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            if ((m_masks[slot] & required) != required) {
+                continue;
+            }
+            if constexpr (std::is_invocable<Function&, StaticEntity, Ts&...>::value) {
+                function(makeId(slot, m_generations[slot]), array<Ts>()[slot]...);
+            }
+            else {
+                function(array<Ts>()[slot]...);
+            }
+        }
+    }
+
+    /**
+     * @brief Runs the systems in order by calling their update(world, deltaTime).
+     */
+    template<typename... Systems>
+    void
+        update(float deltaTime, Systems&... systems) {
+        (systems.update(*this, deltaTime), ...);
+    }
+
+    /**
+     * @brief Destroys every entity.
+     *
+     * The slots and their generations are kept and every generation is bumped, as in
+     * destroy(), so IDs handed out before the call stay stale.
+     */
+    void
+        clear() {
+        m_freeSlots.clear();
+        // Al reves para que create() reuse primero los slots bajos
+        for (uint32_t slot = static_cast<uint32_t>(m_masks.size()); slot-- > 0;) {
+            resetSlot(slot);
+            m_generations[slot]++;
+            m_freeSlots.push_back(slot);
+        }
+        m_alive = 0;
+    }
+
+    /**
+     * @brief Number of live entities.
+     */
+    std::size_t
+        size() const { return m_alive; }
+
+private:
+    /**
+     * @brief Number of times @p T appears in the component list.
+     */
+    template<typename T>
+    static constexpr std::size_t
+        occurrences() { return (std::size_t(0) + ... + (std::is_same<T, Components>::value ? 1 : 0)); }
+
+    static_assert(((occurrences<Components>() == 1) && ...), "StaticWorld component types must be unique");
+
+    /**
+     * @brief indexOf() that refuses types outside the component list at compile time.
+     */
+    template<typename T>
+    static constexpr std::size_t
+        checkedIndex() {
+        static_assert(indexOf<T>() < sizeof...(Components), "T is not a component of this StaticWorld");
+        return indexOf<T>();
+    }
+
+    static StaticEntity
+        makeId(uint32_t slot, uint32_t generation) { return (static_cast<uint64_t>(generation) << 32) | slot; }
+
+    /**
+     * @brief Slot of a live entity. A stale ID is a programming error and stops the engine.
+     */
+    uint32_t
+        checkedSlot(StaticEntity entity) const {
+        if (!isAlive(entity)) {
+            FATAL("StaticWorld", "checkedSlot", "Entity " + std::to_string(entity) + " is not alive");
+        }
+        return static_cast<uint32_t>(entity);
+    }
+
+    /**
+     * @brief Clears the mask of a slot and resets each of its components to T().
+     */
+    void
+        resetSlot(uint32_t slot) {
+        m_masks[slot] = 0;
+        std::apply([slot](auto&... arrays) {
+            ((arrays[slot] = typename std::decay<decltype(arrays)>::type::value_type()), ...);
+        }, m_storage);
+    }
+
+    template<typename T>
+    std::vector<T>&
+        array() { return std::get<checkedIndex<T>()>(m_storage); }
+
+    template<typename T>
+    const std::vector<T>&
+        array() const { return std::get<checkedIndex<T>()>(m_storage); }
+
+    std::tuple<std::vector<Components>...> m_storage; ///< Un arreglo por tipo, indexado por slot.
+    std::vector<Mask> m_masks;                        ///< Componentes presentes por slot.
+    std::vector<uint32_t> m_generations;              ///< Invalida IDs de un slot reciclado.
+    std::vector<uint32_t> m_freeSlots;                ///< Slots libres.
+    std::size_t m_alive = 0;                          ///< Entidades vivas.
+};
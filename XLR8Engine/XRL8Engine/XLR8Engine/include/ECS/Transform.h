@@ -9,39 +9,63 @@
  */
 
 #include <SFML/System/Vector2.hpp>
+#include "TransformSync.h"
 
 class Window;
 
 /**
  * @class Transform
  * @brief Component that holds position, rotation, and scale for an entity.
+ *
+ * Once bound to a TransformSync, every setter marks the transform dirty and the next
+ * TransformSync::flush() pushes the new values into the bound render data.
  */
-class Transform : public Component {
+class Transform : public TComponent<Transform> {
 public:
     Transform()
-        : Component(ComponentType::TRANSFORM),
+        : TComponent(ComponentType::TRANSFORM),
         m_position(0.f, 0.f),
-        m_rotation(0.f, 0.f),
+        m_rotation(0.f),
         m_scale(1.f, 1.f) {
     }
 
-    virtual ~Transform() = default;
-
-    void start() override {}
-    void update(float deltaTime) override {}
-    void render(const EngineUtilities::TSharedPointer<Window>& window) override {}
-    void destroy() override {}
+    virtual ~Transform() {
+        if (m_sync != nullptr) {
+            m_sync->unbind(*this);
+        }
+    }
 
-    void setPosition(const sf::Vector2f& pos) { m_position = pos; }
-    void setRotation(const sf::Vector2f& rot) { m_rotation = rot; }
-    void setScale(const sf::Vector2f& scl) { m_scale = scl; }
+    void setPosition(const sf::Vector2f& pos) { m_position = pos; markDirty(); }
+    void setRotation(float degrees) { m_rotation = degrees; markDirty(); }
+    void setScale(const sf::Vector2f& scl) { m_scale = scl; markDirty(); }
 
     sf::Vector2f getPosition() const { return m_position; }
-    sf::Vector2f getRotation() const { return m_rotation; }
+    float getRotation() const { return m_rotation; }
     sf::Vector2f getScale() const { return m_scale; }
 
+    /**
+     * @brief Whether the transform changed since the last TransformSync::flush().
+     */
+    bool isDirty() const { return m_dirty; }
+
 private:
+    friend class TransformSync;
+
+    /**
+     * @brief Flags the transform as changed and registers it once per frame with its sync stage.
+     */
+    void markDirty() {
+        if (!m_dirty && m_sync != nullptr) {
+            m_dirty = true;
+            m_sync->markDirty(*this);
+        }
+    }
+
     sf::Vector2f m_position;
-    sf::Vector2f m_rotation;
+    float m_rotation; ///< Rotation angle in degrees, clockwise as in SFML.
     sf::Vector2f m_scale;
+
+    TransformSync* m_sync = nullptr;        ///< Sync stage the transform is bound to.
+    sf::Transform* m_target = nullptr;      ///< Render matrix written on flush.
+    bool m_dirty = false;                   ///< Registered in the sync stage's dirty list.
 };
\ No newline at end of file
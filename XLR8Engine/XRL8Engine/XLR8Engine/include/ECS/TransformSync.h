@@ -0,0 +1,71 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file TransformSync.h
+ * @brief Declares the TransformSync stage that pushes changed Transform components into render data.
+ */
+
+class Transform;
+
+/**
+ * @class TransformSync
+ * @brief Keeps render transforms in step with Transform components.
+ *
+ * A Transform bound to a render target registers itself here the first time it changes in
+ * a frame. flush() then walks only those dirty transforms and writes them into their
+ * targets, so static entities cost nothing per frame. The sines and cosines of all dirty
+ * rotations are computed in one VectorMath::sinCos batch and the matrices are written
+ * directly, so SFML never evaluates trigonometry per object.
+ * The stage must outlive the transforms bound to it.
+ */
+class
+    TransformSync {
+public:
+    TransformSync() = default;
+
+    ~TransformSync() = default;
+
+    /**
+     * @brief Binds a transform to the render data it drives and schedules a first sync.
+     *
+     * @param transform Source transform.
+     * @param target Render matrix written on flush().
+     */
+    void
+        bind(Transform& transform, sf::Transform& target);
+
+    /**
+     * @brief Detaches a transform. It is removed from the dirty list if needed.
+     *
+     * @param transform Transform to detach.
+     */
+    void
+        unbind(Transform& transform);
+
+    /**
+     * @brief Writes every dirty transform into its target and clears the dirty list.
+     */
+    void
+        flush();
+
+    /**
+     * @brief Number of transforms waiting for the next flush.
+     */
+    std::size_t
+        getDirtyCount() const { return m_dirty.size(); }
+
+private:
+    friend class Transform;
+
+    /**
+     * @brief Called by Transform the first time it changes since the last flush.
+     */
+    void
+        markDirty(Transform& transform) { m_dirty.push_back(&transform); }
+
+    std::vector<Transform*> m_dirty; ///< Transforms changed since the last flush.
+    std::vector<float> m_angles;     ///< Scratch: dirty rotations in radians.
+    std::vector<float> m_sines;      ///< Scratch: sines of m_angles.
+    std::vector<float> m_cosines;    ///< Scratch: cosines of m_angles.
+};
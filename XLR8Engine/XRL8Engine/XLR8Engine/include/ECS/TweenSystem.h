@@ -0,0 +1,196 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Math/VectorMath.h"
+#include "../Memory/TAlignedArray.h"
+#include <array>
+
+/**
+ * @file TweenSystem.h
+ * @brief Declares the TweenSystem, which animates transforms and shape colors in batches.
+ */
+
+class Transform;
+class CShape;
+
+/**
+ * @brief Identifies a tween of a TweenSystem. 0 is never a valid ID.
+ */
+typedef uint64_t TweenId;
+
+/**
+ * @enum TweenProperty
+ * @brief Property a tween writes.
+ */
+enum
+    TweenProperty {
+    TWEEN_POSITION = 0, ///< Transform position.
+    TWEEN_ROTATION = 1, ///< Transform rotation, in degrees.
+    TWEEN_SCALE = 2,    ///< Transform scale.
+    TWEEN_COLOR = 3,    ///< CShape fill color.
+    TWEEN_PROPERTY_COUNT = 4
+};
+
+/**
+ * @class TweenSystem
+ * @brief Runs many tweens with SIMD kernels instead of per-component update() calls.
+ *
+ * Tweens are grouped in buckets by property and easing curve, and each bucket keeps its
+ * timers, start and end values as structure of arrays. update() advances every bucket
+ * with VectorMath::advanceProgress, VectorMath::ease and VectorMath::lerp, then writes
+ * the results into the targets in one tight loop per bucket and swap-removes the tweens
+ * that finished, so the arrays stay dense.
+ *
+ * Transform targets go through their setters, so a bound TransformSync pushes the new
+ * values into the render data on its next flush. Targets are not owned: call
+ * stopTarget() before destroying a component that still has tweens. When several tweens
+ * drive the same property, the one updated last wins. A tween writes its end value
+ * exactly on its last update.
+ */
+class
+    TweenSystem {
+public:
+    /**
+     * @brief Moves a transform from its current position.
+     *
+     * @param target Transform to animate.
+     * @param to Final position.
+     * @param duration Seconds from start to end.
+     * @param ease Easing curve.
+     * @param delay Seconds before the tween starts. The target is not written meanwhile,
+     * and the start value is read from it when the delay ends.
+     * @return ID of the tween.
+     */
+    TweenId
+        tweenPosition(Transform& target, const sf::Vector2f& to, float duration,
+            EaseType ease = EASE_LINEAR, float delay = 0.f);
+
+    /**
+     * @brief Rotates a transform from its current rotation, in degrees. The angle is
+     * interpolated as given, so 0 to 720 spins twice.
+     */
+    TweenId
+        tweenRotation(Transform& target, float to, float duration,
+            EaseType ease = EASE_LINEAR, float delay = 0.f);
+
+    /**
+     * @brief Scales a transform from its current scale.
+     */
+    TweenId
+        tweenScale(Transform& target, const sf::Vector2f& to, float duration,
+            EaseType ease = EASE_LINEAR, float delay = 0.f);
+
+    /**
+     * @brief Fades a shape's fill color, alpha included, from its current color.
+     */
+    TweenId
+        tweenColor(CShape& target, const sf::Color& to, float duration,
+            EaseType ease = EASE_LINEAR, float delay = 0.f);
+
+    /**
+     * @brief Removes a tween where it stands. Stale IDs are ignored.
+     */
+    void
+        stop(TweenId id);
+
+    /**
+     * @brief Removes every tween of a Transform or CShape.
+     */
+    void
+        stopTarget(const void* target);
+
+    /**
+     * @brief Whether the tween has neither finished nor been stopped.
+     */
+    bool
+        isActive(TweenId id) const;
+
+    /**
+     * @brief Advances every tween and writes the new values.
+     *
+     * @param deltaTime Seconds since the last update.
+     */
+    void
+        update(float deltaTime);
+
+    /**
+     * @brief Removes every tween.
+     */
+    void
+        clear();
+
+    /**
+     * @brief Number of active tweens.
+     */
+    std::size_t
+        size() const { return m_activeCount; }
+
+private:
+    static const std::size_t kMaxComponents = 4; ///< Floats of the widest property, a color.
+    static const std::size_t kBucketCount = static_cast<std::size_t>(TWEEN_PROPERTY_COUNT) * EASE_COUNT; ///< Propiedades por curvas.
+
+    /**
+     * @struct Bucket
+     * @brief Tweens sharing a property and an easing curve.
+     */
+    struct
+        Bucket {
+        EngineUtilities::TAlignedArray<float> elapsed;         ///< Segundos transcurridos; negativos durante el retardo.
+        EngineUtilities::TAlignedArray<float> inverseDuration; ///< 1 / duracion.
+        EngineUtilities::TAlignedArray<float> progress;        ///< Progreso suavizado del frame.
+        EngineUtilities::TAlignedArray<float> from[kMaxComponents];  ///< Valor inicial por componente.
+        EngineUtilities::TAlignedArray<float> to[kMaxComponents];    ///< Valor final por componente.
+        EngineUtilities::TAlignedArray<float> value[kMaxComponents]; ///< Valor interpolado del frame.
+        std::vector<void*> targets;                           ///< Transform o CShape animado.
+        std::vector<uint32_t> slots;                          ///< Slot de cada tween.
+        std::vector<uint8_t> delayed;                         ///< 1 hasta que termina el retardo.
+        std::size_t delayedCount = 0;                         ///< Tweens aun en retardo.
+    };
+
+    /**
+     * @struct Slot
+     * @brief Where a tween lives, so IDs survive swap-removes.
+     */
+    struct
+        Slot {
+        uint32_t generation = 1; ///< Invalida IDs de un slot reciclado.
+        uint32_t bucket = 0;     ///< Bucket del tween.
+        uint32_t index = 0;      ///< Posicion dentro del bucket.
+        bool used = false;       ///< Si el slot tiene un tween.
+    };
+
+    /**
+     * @brief Appends a tween to the bucket of its property and curve.
+     */
+    TweenId
+        add(TweenProperty property, void* target, const float* to,
+            float duration, EaseType ease, float delay);
+
+    /**
+     * @brief Reads the current value of a target's property, one float per component.
+     */
+    static void
+        read(TweenProperty property, const void* target, float* out);
+
+    /**
+     * @brief Reads the start value of the tweens whose delay ended this update.
+     */
+    static void
+        startDelayed(TweenProperty property, Bucket& bucket, std::size_t count);
+
+    /**
+     * @brief Writes the interpolated values of a bucket into its targets.
+     */
+    void
+        write(TweenProperty property, Bucket& bucket, std::size_t count);
+
+    /**
+     * @brief Swap-removes a tween from its bucket and frees its slot.
+     */
+    void
+        removeAt(uint32_t bucketIndex, std::size_t index);
+
+    std::array<Bucket, kBucketCount> m_buckets;                       ///< Un bucket por propiedad y curva.
+    std::vector<Slot> m_slots;                                        ///< Ubicacion de cada tween.
+    std::vector<uint32_t> m_freeSlots;                                ///< Slots libres.
+    std::size_t m_activeCount = 0;                                    ///< Tweens activos.
+};
@@ -0,0 +1,184 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <array>
+#include <bitset>
+
+/**
+ * @file InputSystem.h
+ * @brief Declares the buffered input system: an event ring buffer, key/mouse state bitsets and named actions.
+ */
+
+ /**
+  * @brief Index of a named action, returned by InputSystem::bindAction.
+  */
+typedef uint32_t ActionId;
+
+/**
+ * @struct InputSnapshot
+ * @brief Immutable view of the input state for one frame.
+ *
+ * The snapshot only changes inside Window::handleEvents, so systems running during the
+ * frame, including worker threads, can read it without locks.
+ */
+struct
+    InputSnapshot {
+    static constexpr std::size_t kMaxActions = 64; ///< Number of actions that can be bound.
+    static constexpr ActionId kInvalidAction = kMaxActions; ///< Returned once every action is taken; never active.
+
+    std::bitset<sf::Keyboard::KeyCount> keysDown;       ///< Keys held this frame.
+    std::bitset<sf::Keyboard::KeyCount> keysPressed;    ///< Keys that went down this frame.
+    std::bitset<sf::Keyboard::KeyCount> keysReleased;   ///< Keys that went up this frame.
+    std::bitset<sf::Mouse::ButtonCount> buttonsDown;    ///< Mouse buttons held this frame.
+    std::bitset<sf::Mouse::ButtonCount> buttonsPressed; ///< Mouse buttons that went down this frame.
+    std::bitset<sf::Mouse::ButtonCount> buttonsReleased;///< Mouse buttons that went up this frame.
+    std::bitset<kMaxActions> actionsDown;     ///< Actions with at least one binding held.
+    std::bitset<kMaxActions> actionsPressed;  ///< Actions that became active this frame.
+    std::bitset<kMaxActions> actionsReleased; ///< Actions that became inactive this frame.
+    sf::Vector2i mousePosition;  ///< Last known mouse position in window pixels.
+    float wheelDelta = 0.f;      ///< Vertical wheel movement this frame.
+    bool focused = true;         ///< Whether the window has focus.
+    uint64_t frame = 0;          ///< Frame the snapshot belongs to.
+
+    bool
+        isKeyDown(sf::Keyboard::Key key) const { return key >= 0 && keysDown[key]; }
+
+    bool
+        wasKeyPressed(sf::Keyboard::Key key) const { return key >= 0 && keysPressed[key]; }
+
+    bool
+        wasKeyReleased(sf::Keyboard::Key key) const { return key >= 0 && keysReleased[key]; }
+
+    bool
+        isButtonDown(sf::Mouse::Button button) const { return buttonsDown[button]; }
+
+    bool
+        isActionDown(ActionId action) const { return action < kMaxActions && actionsDown[action]; }
+
+    bool
+        wasActionPressed(ActionId action) const { return action < kMaxActions && actionsPressed[action]; }
+
+    bool
+        wasActionReleased(ActionId action) const { return action < kMaxActions && actionsReleased[action]; }
+};
+
+/**
+ * @class InputSystem
+ * @brief Buffers the window events of a frame and turns them into an InputSnapshot.
+ *
+ * Window::handleEvents calls beginFrame(), pushes every polled event into a fixed-capacity
+ * ring buffer and calls endFrame(), which drains the buffer into the key, mouse and action
+ * bitsets and publishes the snapshot for the frame.
+ */
+class
+    InputSystem {
+public:
+    static constexpr std::size_t kEventCapacity = 256; ///< Events kept per frame.
+
+    InputSystem() = default;
+
+    ~InputSystem() = default;
+
+    /**
+     * @brief Returns the ID of an action, creating it if the name is new.
+     *
+     * Past InputSnapshot::kMaxActions it logs an error and returns
+     * InputSnapshot::kInvalidAction, which bindAction() ignores.
+     *
+     * @param name Name of the action, e.g. "Jump".
+     */
+    ActionId
+        getActionId(const std::string& name);
+
+    /**
+     * @brief Binds a key to a named action. An action may have several bindings.
+     *
+     * @param name Name of the action.
+     * @param key Key that triggers the action.
+     * @return ID of the action, for O(1) queries on the snapshot.
+     */
+    ActionId
+        bindAction(const std::string& name, sf::Keyboard::Key key);
+
+    /**
+     * @brief Binds a mouse button to a named action.
+     *
+     * @param name Name of the action.
+     * @param button Mouse button that triggers the action.
+     * @return ID of the action.
+     */
+    ActionId
+        bindAction(const std::string& name, sf::Mouse::Button button);
+
+    /**
+     * @brief Clears the event buffer and the per-frame edges.
+     */
+    void
+        beginFrame();
+
+    /**
+     * @brief Stores an event for this frame.
+     *
+     * When the buffer is full the event is dropped and counted in getDroppedEvents().
+     *
+     * @param event Event polled from the window.
+     */
+    void
+        pushEvent(const sf::Event& event);
+
+    /**
+     * @brief Applies the buffered events and publishes the snapshot of the frame.
+     */
+    void
+        endFrame();
+
+    /**
+     * @brief Input state of the current frame.
+     */
+    const InputSnapshot&
+        getSnapshot() const { return m_snapshot; }
+
+    /**
+     * @brief Number of events buffered this frame.
+     */
+    std::size_t
+        getEventCount() const { return m_eventCount; }
+
+    /**
+     * @brief Returns the i-th event buffered this frame, in arrival order.
+     */
+    const sf::Event&
+        getEvent(std::size_t index) const { return m_events[(m_eventHead + index) % kEventCapacity]; }
+
+    /**
+     * @brief Events dropped because the buffer was full, since creation.
+     */
+    uint64_t
+        getDroppedEvents() const { return m_droppedEvents; }
+
+private:
+    /**
+     * @struct ActionBinding
+     * @brief Raw input that drives an action.
+     */
+    struct
+        ActionBinding {
+        ActionId action; ///< Action driven by the binding.
+        bool isKey;      ///< true for a keyboard key, false for a mouse button.
+        int code;        ///< sf::Keyboard::Key or sf::Mouse::Button value.
+    };
+
+    /**
+     * @brief Updates the bitsets for one event.
+     */
+    void
+        applyEvent(const sf::Event& event);
+
+    std::array<sf::Event, kEventCapacity> m_events; ///< Ring buffer of this frame's events.
+    std::size_t m_eventHead = 0;  ///< Index of the oldest buffered event.
+    std::size_t m_eventCount = 0; ///< Number of buffered events.
+    uint64_t m_droppedEvents = 0; ///< Events lost to a full buffer.
+
+    std::vector<ActionBinding> m_bindings;                  ///< Every key and button binding.
+    std::unordered_map<std::string, ActionId> m_actionIds;  ///< Action ID by name.
+    InputSnapshot m_snapshot;                               ///< State published by endFrame.
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CVector2.h"
+
+/**
+ * @file CMatrix2.h
+ * @brief Declares CMatrix2, a constexpr 2x2 matrix for rotations and scales.
+ */
+
+ /**
+  * @class CMatrix2
+  * @brief Column-major 2x2 matrix.
+  *
+  * | m00  m01 |
+  * | m10  m11 |
+  */
+class CMatrix2 {
+public:
+    float m00;
+    float m10;
+    float m01;
+    float m11;
+
+    /**
+     * @brief Identity matrix.
+     */
+    constexpr CMatrix2() : m00(1.f), m10(0.f), m01(0.f), m11(1.f) {}
+
+    constexpr CMatrix2(float m00, float m01, float m10, float m11)
+        : m00(m00), m10(m10), m01(m01), m11(m11) {}
+
+    /**
+     * @brief Counter-clockwise rotation by an angle in radians.
+     */
+    static constexpr CMatrix2 rotation(float radians) {
+        const float c = ConstMath::cos(radians);
+        const float s = ConstMath::sin(radians);
+        return CMatrix2(c, -s, s, c);
+    }
+
+    /**
+     * @brief Rotation by an angle in degrees, the unit used by SFML and Transform.
+     */
+    static constexpr CMatrix2 rotationDegrees(float degrees) {
+        return rotation(degrees * ConstMath::DEG_TO_RAD);
+    }
+
+    /**
+     * @brief Non-uniform scale.
+     */
+    static constexpr CMatrix2 scale(float sx, float sy) {
+        return CMatrix2(sx, 0.f, 0.f, sy);
+    }
+
+    constexpr CVector2 operator*(const CVector2& v) const {
+        return CVector2(m00 * v.x + m01 * v.y, m10 * v.x + m11 * v.y);
+    }
+
+    constexpr CMatrix2 operator*(const CMatrix2& o) const {
+        return CMatrix2(m00 * o.m00 + m01 * o.m10, m00 * o.m01 + m01 * o.m11,
+            m10 * o.m00 + m11 * o.m10, m10 * o.m01 + m11 * o.m11);
+    }
+
+    constexpr bool operator==(const CMatrix2& o) const {
+        return m00 == o.m00 && m01 == o.m01 && m10 == o.m10 && m11 == o.m11;
+    }
+
+    constexpr float determinant() const {
+        return m00 * m11 - m01 * m10;
+    }
+
+    constexpr CMatrix2 transposed() const {
+        return CMatrix2(m00, m10, m01, m11);
+    }
+};
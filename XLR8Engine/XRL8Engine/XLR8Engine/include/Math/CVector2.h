@@ -0,0 +1,148 @@
+#pragma once
+
+#include "ConstMath.h"
+#include <SFML/System/Vector2.hpp>
+#include <iostream>
+
+/**
+ * @file CVector2.h
+ * @brief Declares CVector2, the scalar 2D vector. Every operation is constexpr.
+ */
+class CVector2 {
+public:
+    float x;
+    float y;
+
+    // Para los constructores
+    constexpr CVector2() : x(0.f), y(0.f) {}
+    constexpr CVector2(float x, float y) : x(x), y(y) {}
+
+    // Para los operadores aritmeticos
+    constexpr CVector2 operator+(const CVector2& other) const {
+        return CVector2(x + other.x, y + other.y);
+    }
+
+    constexpr CVector2 operator-(const CVector2& other) const {
+        return CVector2(x - other.x, y - other.y);
+    }
+
+    constexpr CVector2 operator-() const {
+        return CVector2(-x, -y);
+    }
+
+    constexpr CVector2 operator*(float scalar) const {
+        return CVector2(x * scalar, y * scalar);
+    }
+
+    constexpr CVector2 operator/(float scalar) const {
+        return CVector2(x / scalar, y / scalar);
+    }
+
+
+    constexpr CVector2& operator+=(const CVector2& other) {
+        x += other.x; y += other.y;
+        return *this;
+    }
+
+    constexpr CVector2& operator-=(const CVector2& other) {
+        x -= other.x; y -= other.y;
+        return *this;
+    }
+
+    constexpr CVector2& operator*=(float scalar) {
+        x *= scalar; y *= scalar;
+        return *this;
+    }
+
+    constexpr CVector2& operator/=(float scalar) {
+        x /= scalar; y /= scalar;
+        return *this;
+    }
+
+
+    constexpr bool operator==(const CVector2& other) const {
+        return x == other.x && y == other.y;
+    }
+
+    constexpr bool operator!=(const CVector2& other) const {
+        return !(*this == other);
+    }
+
+
+    constexpr float& operator[](int index) {
+        return (index == 0) ? x : y;
+    }
+
+    constexpr const float& operator[](int index) const {
+        return (index == 0) ? x : y;
+    }
+
+
+    friend std::ostream& operator<<(std::ostream& os, const CVector2& v) {
+        os << "(" << v.x << ", " << v.y << ")";
+        return os;
+    }
+
+
+    constexpr float dot(const CVector2& other) const {
+        return x * other.x + y * other.y;
+    }
+
+
+    constexpr float cross(const CVector2& other) const {
+        return x * other.y - y * other.x;
+    }
+
+
+    static constexpr CVector2 zero() {
+        return CVector2(0.f, 0.f);
+    }
+
+    static constexpr CVector2 one() {
+        return CVector2(1.f, 1.f);
+    }
+
+    /**
+     * @brief Unit vector pointing at an angle, in radians, from the +X axis.
+     */
+    static constexpr CVector2 fromAngle(float radians) {
+        return CVector2(ConstMath::cos(radians), ConstMath::sin(radians));
+    }
+
+
+    void move(const sf::Vector2f& offset) {
+        x += offset.x;
+        y += offset.y;
+    }
+
+    /**
+     * @brief Converts to the SFML vector type.
+     */
+    sf::Vector2f toVector2f() const {
+        return sf::Vector2f(x, y);
+    }
+
+
+    constexpr float lengthSquared() const {
+        return x * x + y * y;
+    }
+
+    constexpr float length() const {
+        return ConstMath::sqrt(lengthSquared());
+    }
+
+    /**
+     * @brief Returns the vector scaled to length 1. The zero vector stays zero.
+     */
+    constexpr CVector2 normalized() const {
+        const float len = length();
+        return len > 0.f ? CVector2(x / len, y / len) : CVector2();
+    }
+
+    /**
+     * @brief Vector rotated 90 degrees counter-clockwise.
+     */
+    constexpr CVector2 perpendicular() const {
+        return CVector2(-y, x);
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file ConstMath.h
+ * @brief constexpr implementations of sqrt, sin and cos for compile-time geometry.
+ *
+ * Each function uses the series implementation while the compiler evaluates a constant
+ * expression and the <cmath> function at runtime, so the same call works in both contexts.
+ */
+namespace ConstMath {
+
+    constexpr float PI = 3.14159265358979323846f;       ///< Pi.
+    constexpr float TWO_PI = 6.28318530717958647692f;   ///< 2 * Pi.
+    constexpr float DEG_TO_RAD = PI / 180.f;            ///< Degrees to radians factor.
+
+    /**
+     * @brief Whether the caller is being evaluated as a constant expression.
+     */
+    constexpr bool
+        isConstantEvaluated() {
+#if defined(__cpp_lib_is_constant_evaluated)
+        return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+        return __builtin_is_constant_evaluated();
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Square root by Newton iteration in double precision.
+     */
+    constexpr double
+        sqrtNewton(double value) {
+        if (!(value > 0.0)) {
+            return 0.0;
+        }
+        double guess = value > 1.0 ? value : 1.0;
+        for (int i = 0; i < 128; ++i) {
+            const double next = 0.5 * (guess + value / guess);
+            if (next >= guess) {
+                break;
+            }
+            guess = next;
+        }
+        return guess;
+    }
+
+    /**
+     * @brief Sine by Taylor series after reducing the angle to [-pi, pi].
+     */
+    constexpr double
+        sinSeries(double radians) {
+        const double twoPi = 6.28318530717958647692;
+        const double turns = radians / twoPi;
+        const long long whole = static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5);
+        const double x = radians - static_cast<double>(whole) * twoPi;
+
+        double term = x;
+        double sum = x;
+        for (int n = 1; n < 20; ++n) {
+            term *= -x * x / static_cast<double>((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Square root usable in constant expressions. Negative inputs return 0.
+     */
+    constexpr float
+        sqrt(float value) {
+        if (isConstantEvaluated()) {
+            return static_cast<float>(sqrtNewton(value));
+        }
+        return value > 0.f ? std::sqrt(value) : 0.f;
+    }
+
+    /**
+     * @brief Sine of an angle in radians, usable in constant expressions.
+     */
+    constexpr float
+        sin(float radians) {
+        if (isConstantEvaluated()) {
+            return static_cast<float>(sinSeries(radians));
+        }
+        return std::sin(radians);
+    }
+
+    /**
+     * @brief Cosine of an angle in radians, usable in constant expressions.
+     */
+    constexpr float
+        cos(float radians) {
+        if (isConstantEvaluated()) {
+            return static_cast<float>(sinSeries(static_cast<double>(radians) + 1.57079632679489661923));
+        }
+        return std::cos(radians);
+    }
+
+    static_assert(sqrtNewton(16.0) == 4.0, "ConstMath::sqrt");
+    static_assert(sinSeries(0.0) == 0.0, "ConstMath::sin");
+    static_assert(sinSeries(1.57079632679489661923) > 0.999999 && sinSeries(1.57079632679489661923) < 1.000001, "ConstMath::sin");
+}
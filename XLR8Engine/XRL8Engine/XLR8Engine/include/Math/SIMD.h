@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @file SIMD.h
+ * @brief Selects the instruction set used by the batch math kernels at compile time.
+ *
+ * XLR8_SIMD_AVX2 is defined when the compiler targets AVX2 (-mavx2 -mfma, /arch:AVX2),
+ * XLR8_SIMD_SSE2 when it targets SSE2 (any x86-64 build). Defining XLR8_NO_SIMD forces
+ * the scalar code path. XLR8_SIMD_WIDTH is the number of float lanes per instruction.
+ */
+
+#if !defined(XLR8_NO_SIMD) && defined(__AVX2__)
+#define XLR8_SIMD_AVX2 1
+#define XLR8_SIMD_SSE2 1
+#define XLR8_SIMD_WIDTH 8
+#include <immintrin.h>
+#elif !defined(XLR8_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define XLR8_SIMD_SSE2 1
+#define XLR8_SIMD_WIDTH 4
+#include <emmintrin.h>
+#else
+#define XLR8_SIMD_WIDTH 1
+#endif
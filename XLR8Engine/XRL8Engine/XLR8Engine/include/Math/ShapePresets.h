@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CMatrix2.h"
+#include <array>
+
+/**
+ * @file ShapePresets.h
+ * @brief Built-in shape geometry generated at compile time.
+ */
+namespace ShapePresets {
+
+    /**
+     * @brief Outline of a circle as SFML lays it out: the first point is at the top and the
+     * bounding box starts at (0, 0).
+     *
+     * @tparam PointCount Number of outline points.
+     * @param radius Radius of the circle.
+     */
+    template<std::size_t PointCount>
+    constexpr std::array<CVector2, PointCount>
+        circle(float radius) {
+        std::array<CVector2, PointCount> points{};
+        const CVector2 center(radius, radius);
+        for (std::size_t i = 0; i < PointCount; ++i) {
+            const float angle = static_cast<float>(i) * ConstMath::TWO_PI / PointCount - ConstMath::PI / 2.f;
+            points[i] = center + CVector2::fromAngle(angle) * radius;
+        }
+        return points;
+    }
+
+    /**
+     * @brief Outline of a regular polygon centered on the origin, first point at the top.
+     *
+     * @tparam PointCount Number of corners.
+     * @param radius Distance from the center to every corner.
+     */
+    template<std::size_t PointCount>
+    constexpr std::array<CVector2, PointCount>
+        regularPolygon(float radius) {
+        std::array<CVector2, PointCount> points{};
+        const CMatrix2 step = CMatrix2::rotation(ConstMath::TWO_PI / PointCount);
+        CVector2 corner(0.f, -radius);
+        for (std::size_t i = 0; i < PointCount; ++i) {
+            points[i] = corner;
+            corner = step * corner;
+        }
+        return points;
+    }
+
+    constexpr float kCircleRadius = 10.f;          ///< Radius of the default circle.
+    constexpr std::size_t kCirclePointCount = 30;  ///< Outline points of the default circle.
+    constexpr CVector2 kRectangleSize(100.f, 50.f);///< Size of the default rectangle.
+
+    /// Outline of the default circle.
+    constexpr std::array<CVector2, kCirclePointCount> kCircle = circle<kCirclePointCount>(kCircleRadius);
+
+    /// Outline of the default triangle.
+    constexpr std::array<CVector2, 3> kTriangle = { {
+        CVector2(0.f, 0.f), CVector2(50.f, 100.f), CVector2(100.f, 0.f) } };
+
+    /// Outline of the default polygon.
+    constexpr std::array<CVector2, 5> kPentagon = { {
+        CVector2(0.f, 0.f), CVector2(50.f, 100.f), CVector2(100.f, 0.f),
+        CVector2(75.f, -50.f), CVector2(-25.f, -50.f) } };
+
+    static_assert(kCircle[0].x > 9.99f && kCircle[0].x < 10.01f && kCircle[0].y > -0.01f && kCircle[0].y < 0.01f,
+        "The default circle starts at the top");
+}
@@ -0,0 +1,254 @@
+#pragma once
+#include "VectorStream.h"
+#include <cmath>
+
+/**
+ * @file VectorMath.h
+ * @brief Declares the batch kernels that operate on SoA vector and matrix streams.
+ *
+ * Every kernel processes XLR8_SIMD_WIDTH elements per instruction (see SIMD.h) and
+ * finishes the tail with scalar code. Outputs may alias inputs for in-place updates.
+ */
+
+/**
+ * @enum EaseType
+ * @brief Easing curves of VectorMath::ease. Every curve maps 0 to 0 and 1 to 1.
+ */
+enum
+    EaseType {
+    EASE_LINEAR = 0,       ///< t.
+    EASE_IN_QUAD = 1,      ///< t^2.
+    EASE_OUT_QUAD = 2,     ///< 1 - (1 - t)^2.
+    EASE_IN_OUT_QUAD = 3,  ///< Quadratic in the first half, mirrored in the second.
+    EASE_IN_CUBIC = 4,     ///< t^3.
+    EASE_OUT_CUBIC = 5,    ///< 1 - (1 - t)^3.
+    EASE_IN_OUT_CUBIC = 6, ///< Cubic in the first half, mirrored in the second.
+    EASE_SMOOTHSTEP = 7,   ///< t^2 (3 - 2t).
+    EASE_COUNT = 8
+};
+
+namespace VectorMath {
+
+    /**
+     * @brief Name of the instruction set the kernels were compiled for: "AVX2", "SSE2" or "Scalar".
+     */
+    const char*
+        simdName();
+
+    /**
+     * @brief out = a + b.
+     */
+    void
+        add(const float* ax, const float* ay, const float* bx, const float* by,
+            float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief out = a - b.
+     */
+    void
+        sub(const float* ax, const float* ay, const float* bx, const float* by,
+            float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief out = a * scalar.
+     */
+    void
+        scale(const float* ax, const float* ay, float scalar,
+            float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief a += b * scalar, e.g. position += velocity * deltaTime.
+     */
+    void
+        addScaled(float* ax, float* ay, const float* bx, const float* by,
+            float scalar, std::size_t count);
+
+    /**
+     * @brief values[i] += scalar, e.g. remaining lifetime -= deltaTime.
+     */
+    void
+        addScalar(float* values, float scalar, std::size_t count);
+
+    /**
+     * @brief Advances timers and returns their clamped progress: elapsed[i] += dt, then
+     * outT[i] = clamp(elapsed[i] * inverseDuration[i], 0, 1).
+     */
+    void
+        advanceProgress(float* elapsed, const float* inverseDuration, float dt,
+            float* outT, std::size_t count);
+
+    /**
+     * @brief out[i] = curve(t[i]) for one easing curve. t must be in [0, 1].
+     */
+    void
+        ease(EaseType type, const float* t, float* out, std::size_t count);
+
+    /**
+     * @brief out[i] = from[i] + (to[i] - from[i]) * t[i].
+     */
+    void
+        lerp(const float* from, const float* to, const float* t, float* out, std::size_t count);
+
+    /**
+     * @brief Explicit Euler step of point masses under a constant acceleration.
+     *
+     * v = (v + acceleration * dt) * damping, then p += v * dt.
+     */
+    void
+        integrate(float* px, float* py, float* vx, float* vy, const sf::Vector2f& acceleration,
+            float damping, float dt, std::size_t count);
+
+    /**
+     * @brief out[i] = dot(a[i], b[i]).
+     */
+    void
+        dot(const float* ax, const float* ay, const float* bx, const float* by,
+            float* out, std::size_t count);
+
+    /**
+     * @brief out[i] = |a[i]|.
+     */
+    void
+        length(const float* ax, const float* ay, float* out, std::size_t count);
+
+    /**
+     * @brief out[i] = a[i] / |a[i]|. Zero vectors stay zero.
+     */
+    void
+        normalize(const float* ax, const float* ay, float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief Transforms every point by the same matrix.
+     */
+    void
+        transform(const Affine2& m, const float* px, const float* py,
+            float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief Transforms point i by matrix i.
+     */
+    void
+        transform(const Affine2Stream& m, const float* px, const float* py,
+            float* outX, float* outY, std::size_t count);
+
+    /**
+     * @brief Wraps an angle in degrees into (-360, 360), so that after the conversion to
+     * radians it stays inside the accurate range of sinCos() however long it grew.
+     */
+    inline float
+        wrapDegrees(float degrees) { return std::isfinite(degrees) ? std::fmod(degrees, 360.f) : 0.f; }
+
+    /**
+     * @brief Sine and cosine of many angles at once.
+     *
+     * Uses the Cephes single-precision reduction and minimax polynomials instead of libm.
+     * For |radians| < 8192 the absolute error is below 1.5e-7 and every
+     * instruction set produces the same results. Larger inputs are not supported: wrap
+     * angles in degrees with wrapDegrees() before converting them.
+     *
+     * @param radians Input angles in radians.
+     * @param outSin Receives sin(radians[i]).
+     * @param outCos Receives cos(radians[i]).
+     * @param count Number of angles.
+     */
+    void
+        sinCos(const float* radians, float* outSin, float* outCos, std::size_t count);
+
+    /**
+     * @brief Builds the matrix sf::Transformable::getTransform() gives for a zero origin,
+     * from a precomputed sine and cosine of the rotation.
+     */
+    inline sf::Transform
+        composeTransform(const sf::Vector2f& position, float sine, float cosine, const sf::Vector2f& scale) {
+        return sf::Transform(scale.x * cosine, -scale.y * sine, position.x,
+            scale.x * sine, scale.y * cosine, position.y,
+            0.f, 0.f, 1.f);
+    }
+
+    /**
+     * @brief Builds a position, rotation and scale matrix with the sinCos polynomial
+     * instead of libm.
+     *
+     * @param degrees Rotation angle in degrees, clockwise as in SFML.
+     */
+    sf::Transform
+        composeTransform(const sf::Vector2f& position, float degrees, const sf::Vector2f& scale);
+
+    /**
+     * @brief out = a + b over whole streams. out is resized to a.size().
+     */
+    inline void
+        add(const Vector2Stream& a, const Vector2Stream& b, Vector2Stream& out) {
+        out.resize(a.size());
+        add(a.x(), a.y(), b.x(), b.y(), out.x(), out.y(), a.size());
+    }
+
+    /**
+     * @brief out = a - b over whole streams. out is resized to a.size().
+     */
+    inline void
+        sub(const Vector2Stream& a, const Vector2Stream& b, Vector2Stream& out) {
+        out.resize(a.size());
+        sub(a.x(), a.y(), b.x(), b.y(), out.x(), out.y(), a.size());
+    }
+
+    /**
+     * @brief out = a * scalar over whole streams. out is resized to a.size().
+     */
+    inline void
+        scale(const Vector2Stream& a, float scalar, Vector2Stream& out) {
+        out.resize(a.size());
+        scale(a.x(), a.y(), scalar, out.x(), out.y(), a.size());
+    }
+
+    /**
+     * @brief a += b * scalar over whole streams.
+     */
+    inline void
+        addScaled(Vector2Stream& a, const Vector2Stream& b, float scalar) {
+        addScaled(a.x(), a.y(), b.x(), b.y(), scalar, a.size());
+    }
+
+    /**
+     * @brief out[i] = dot(a[i], b[i]). out must hold a.size() floats.
+     */
+    inline void
+        dot(const Vector2Stream& a, const Vector2Stream& b, float* out) {
+        dot(a.x(), a.y(), b.x(), b.y(), out, a.size());
+    }
+
+    /**
+     * @brief out[i] = |a[i]|. out must hold a.size() floats.
+     */
+    inline void
+        length(const Vector2Stream& a, float* out) {
+        length(a.x(), a.y(), out, a.size());
+    }
+
+    /**
+     * @brief out[i] = a[i] / |a[i]|. out is resized to a.size().
+     */
+    inline void
+        normalize(const Vector2Stream& a, Vector2Stream& out) {
+        out.resize(a.size());
+        normalize(a.x(), a.y(), out.x(), out.y(), a.size());
+    }
+
+    /**
+     * @brief Transforms every point by the same matrix. out is resized to points.size().
+     */
+    inline void
+        transform(const Affine2& m, const Vector2Stream& points, Vector2Stream& out) {
+        out.resize(points.size());
+        transform(m, points.x(), points.y(), out.x(), out.y(), points.size());
+    }
+
+    /**
+     * @brief Transforms point i by matrix i. out is resized to points.size().
+     */
+    inline void
+        transform(const Affine2Stream& m, const Vector2Stream& points, Vector2Stream& out) {
+        out.resize(points.size());
+        transform(m, points.x(), points.y(), out.x(), out.y(), points.size());
+    }
+}
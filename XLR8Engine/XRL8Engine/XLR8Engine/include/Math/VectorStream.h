@@ -0,0 +1,138 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "Memory/TAlignedArray.h"
+
+/**
+ * @file VectorStream.h
+ * @brief Declares SoA streams of 2D vectors and 2D affine matrices for the batch math kernels.
+ */
+
+ /**
+  * @struct Affine2
+  * @brief 3x3 affine matrix with an implicit last row of (0, 0, 1).
+  *
+  * | a  c  tx |
+  * | b  d  ty |
+  * | 0  0  1  |
+  */
+struct
+    Affine2 {
+    float a = 1.f;  ///< Row 0, column 0.
+    float b = 0.f;  ///< Row 1, column 0.
+    float c = 0.f;  ///< Row 0, column 1.
+    float d = 1.f;  ///< Row 1, column 1.
+    float tx = 0.f; ///< Translation on x.
+    float ty = 0.f; ///< Translation on y.
+};
+
+/**
+ * @class Vector2Stream
+ * @brief Structure-of-arrays storage for many 2D vectors.
+ *
+ * X and Y components live in separate 32-byte aligned arrays so the kernels in
+ * VectorMath.h process 4 (SSE2) or 8 (AVX2) vectors per instruction.
+ */
+class
+    Vector2Stream {
+public:
+    Vector2Stream() = default;
+
+    explicit Vector2Stream(std::size_t count) { resize(count); }
+
+    void
+        resize(std::size_t count) { m_x.resize(count); m_y.resize(count); }
+
+    void
+        reserve(std::size_t count) { m_x.reserve(count); m_y.reserve(count); }
+
+    void
+        clear() { m_x.clear(); m_y.clear(); }
+
+    void
+        push_back(float x, float y) { m_x.push_back(x); m_y.push_back(y); }
+
+    void
+        set(std::size_t index, const sf::Vector2f& value) { m_x[index] = value.x; m_y[index] = value.y; }
+
+    sf::Vector2f
+        get(std::size_t index) const { return sf::Vector2f(m_x[index], m_y[index]); }
+
+    /**
+     * @brief Moves the last vector into @p index and shrinks the stream by one.
+     */
+    void
+        swapRemove(std::size_t index) {
+        m_x[index] = m_x[m_x.size() - 1];
+        m_y[index] = m_y[m_y.size() - 1];
+        m_x.pop_back();
+        m_y.pop_back();
+    }
+
+    std::size_t
+        size() const { return m_x.size(); }
+
+    float* x() { return m_x.data(); }
+    float* y() { return m_y.data(); }
+    const float* x() const { return m_x.data(); }
+    const float* y() const { return m_y.data(); }
+
+private:
+    EngineUtilities::TAlignedArray<float> m_x; ///< X components.
+    EngineUtilities::TAlignedArray<float> m_y; ///< Y components.
+};
+
+/**
+ * @class Affine2Stream
+ * @brief Structure-of-arrays storage for many Affine2 matrices, one per entity.
+ */
+class
+    Affine2Stream {
+public:
+    Affine2Stream() = default;
+
+    explicit Affine2Stream(std::size_t count) { resize(count); }
+
+    void
+        resize(std::size_t count) {
+        m_a.resize(count); m_b.resize(count); m_c.resize(count);
+        m_d.resize(count); m_tx.resize(count); m_ty.resize(count);
+    }
+
+    void
+        set(std::size_t index, const Affine2& m) {
+        m_a[index] = m.a; m_b[index] = m.b; m_c[index] = m.c;
+        m_d[index] = m.d; m_tx[index] = m.tx; m_ty[index] = m.ty;
+    }
+
+    Affine2
+        get(std::size_t index) const {
+        Affine2 m;
+        m.a = m_a[index]; m.b = m_b[index]; m.c = m_c[index];
+        m.d = m_d[index]; m.tx = m_tx[index]; m.ty = m_ty[index];
+        return m;
+    }
+
+    std::size_t
+        size() const { return m_a.size(); }
+
+    float* a() { return m_a.data(); }
+    float* b() { return m_b.data(); }
+    float* c() { return m_c.data(); }
+    float* d() { return m_d.data(); }
+    float* tx() { return m_tx.data(); }
+    float* ty() { return m_ty.data(); }
+    const float* a() const { return m_a.data(); }
+    const float* b() const { return m_b.data(); }
+    const float* c() const { return m_c.data(); }
+    const float* d() const { return m_d.data(); }
+    const float* tx() const { return m_tx.data(); }
+    const float* ty() const { return m_ty.data(); }
+
+private:
+    EngineUtilities::TAlignedArray<float> m_a;  ///< Column 0, row 0.
+    EngineUtilities::TAlignedArray<float> m_b;  ///< Column 0, row 1.
+    EngineUtilities::TAlignedArray<float> m_c;  ///< Column 1, row 0.
+    EngineUtilities::TAlignedArray<float> m_d;  ///< Column 1, row 1.
+    EngineUtilities::TAlignedArray<float> m_tx; ///< Translation x.
+    EngineUtilities::TAlignedArray<float> m_ty; ///< Translation y.
+};
@@ -0,0 +1,180 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Clase MemoryArena, asignador lineal por bloques.
+	 *
+	 * Reparte memoria avanzando un puntero dentro de bloques grandes y nunca libera
+	 * asignaciones sueltas: todo se devuelve de una vez en release(). Liberar cuesta un
+	 * free por bloque, sin importar cuantos objetos haya, y los objetos con destructor
+	 * trivial no se recorren. Los objetos con destructor no trivial creados con create()
+	 * se destruyen en orden inverso al liberar.
+	 *
+	 * No es seguro entre hilos: cada arena pertenece a un solo hilo a la vez.
+	 */
+	class MemoryArena
+	{
+	public:
+		/**
+		 * @brief Constructor. No reserva memoria hasta la primera asignacion.
+		 *
+		 * @param blockSize Bytes de cada bloque. Las asignaciones mayores reciben un bloque propio.
+		 */
+		explicit MemoryArena(std::size_t blockSize = 64 * 1024) : m_blockSize(blockSize) {}
+
+		/**
+		 * @brief Destructor. Libera todos los bloques.
+		 */
+		~MemoryArena() { release(); }
+
+		MemoryArena(const MemoryArena&) = delete;
+		MemoryArena& operator=(const MemoryArena&) = delete;
+
+		/**
+		 * @brief Reserva memoria sin inicializar.
+		 *
+		 * @param size Bytes pedidos.
+		 * @param alignment Alineacion, potencia de dos.
+		 * @return Memoria valida hasta release().
+		 */
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+		{
+			if (m_head != nullptr)
+			{
+				void* memory = bump(m_head, size, alignment);
+				if (memory != nullptr)
+				{
+					return memory;
+				}
+			}
+
+			const std::size_t needed = size + alignment + sizeof(Block);
+			const std::size_t capacity = needed > m_blockSize ? needed : m_blockSize;
+			Block* block = static_cast<Block*>(::operator new(capacity));
+			block->next = m_head;
+			block->capacity = capacity;
+			block->used = sizeof(Block);
+			m_head = block;
+			m_reservedBytes += capacity;
+			return bump(block, size, alignment);
+		}
+
+		/**
+		 * @brief Construye un objeto dentro de la arena.
+		 *
+		 * Si T tiene destructor no trivial, se registra para llamarlo en release().
+		 */
+		template<typename T, typename... Args>
+		T* create(Args&&... args)
+		{
+			if constexpr (std::is_trivially_destructible<T>::value)
+			{
+				return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+			}
+			else
+			{
+				Finalizer* finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer), alignof(Finalizer)));
+				T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+				finalizer->object = object;
+				finalizer->destroy = [](void* pointer) { static_cast<T*>(pointer)->~T(); };
+				finalizer->next = m_finalizers;
+				m_finalizers = finalizer;
+				return object;
+			}
+		}
+
+		/**
+		 * @brief Reserva count elementos inicializados por valor. Solo tipos con destructor trivial.
+		 */
+		template<typename T>
+		T* createArray(std::size_t count)
+		{
+			static_assert(std::is_trivially_destructible<T>::value, "createArray solo admite destructores triviales");
+			T* elements = static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				new (elements + i) T();
+			}
+			return elements;
+		}
+
+		/**
+		 * @brief Destruye los objetos registrados y libera todos los bloques.
+		 */
+		void release()
+		{
+			while (m_finalizers != nullptr)
+			{
+				Finalizer* finalizer = m_finalizers;
+				m_finalizers = finalizer->next;
+				finalizer->destroy(finalizer->object);
+			}
+			while (m_head != nullptr)
+			{
+				Block* next = m_head->next;
+				::operator delete(m_head);
+				m_head = next;
+			}
+			m_usedBytes = 0;
+			m_reservedBytes = 0;
+		}
+
+		/**
+		 * @brief Bytes entregados por allocate(), sin contar relleno de alineacion.
+		 */
+		std::size_t getUsedBytes() const { return m_usedBytes; }
+
+		/**
+		 * @brief Bytes reservados en bloques.
+		 */
+		std::size_t getReservedBytes() const { return m_reservedBytes; }
+
+	private:
+		/**
+		 * @brief Cabecera de un bloque; los datos van detras.
+		 */
+		struct Block
+		{
+			Block* next;           ///< Bloque anterior.
+			std::size_t capacity;  ///< Bytes del bloque, cabecera incluida.
+			std::size_t used;      ///< Bytes ocupados, cabecera incluida.
+		};
+
+		/**
+		 * @brief Destructor pendiente de un objeto creado con create().
+		 */
+		struct Finalizer
+		{
+			Finalizer* next;             ///< Finalizador registrado antes.
+			void (*destroy)(void*);      ///< Llama al destructor del tipo.
+			void* object;                ///< Objeto a destruir.
+		};
+
+		/**
+		 * @brief Avanza el puntero del bloque, o devuelve nullptr si no cabe.
+		 */
+		void* bump(Block* block, std::size_t size, std::size_t alignment)
+		{
+			const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block);
+			const std::uintptr_t start = (base + block->used + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+			if (start + size > base + block->capacity)
+			{
+				return nullptr;
+			}
+			block->used = start + size - base;
+			m_usedBytes += size;
+			return reinterpret_cast<void*>(start);
+		}
+
+		std::size_t m_blockSize;               ///< Bytes de un bloque normal.
+		Block* m_head = nullptr;               ///< Bloque actual; enlaza a los anteriores.
+		Finalizer* m_finalizers = nullptr;     ///< Destructores pendientes, el ultimo primero.
+		std::size_t m_usedBytes = 0;           ///< Bytes entregados.
+		std::size_t m_reservedBytes = 0;       ///< Bytes reservados.
+	};
+}
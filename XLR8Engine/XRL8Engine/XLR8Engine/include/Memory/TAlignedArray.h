@@ -0,0 +1,189 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Clase TAlignedArray para arreglos contiguos alineados.
+	 *
+	 * Gestiona un bloque de memoria alineado a Alignment bytes, pensado para los flujos
+	 * SoA que procesan los kernels SIMD. Solo admite tipos triviales, por lo que crecer o
+	 * liberar el arreglo no llama constructores ni destructores.
+	 */
+	template<typename T, std::size_t Alignment = 32>
+	class TAlignedArray
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "TAlignedArray solo admite tipos triviales");
+		static_assert((Alignment & (Alignment - 1)) == 0, "La alineacion debe ser potencia de dos");
+
+	public:
+		/**
+		 * @brief Constructor por defecto. No reserva memoria.
+		 */
+		TAlignedArray() = default;
+
+		/**
+		 * @brief Constructor que reserva y pone en cero count elementos.
+		 *
+		 * @param count Numero de elementos.
+		 */
+		explicit TAlignedArray(std::size_t count) { resize(count); }
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TAlignedArray(const TAlignedArray& other)
+		{
+			resize(other.m_size);
+			if (m_size > 0)
+			{
+				std::memcpy(m_data, other.m_data, m_size * sizeof(T));
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TAlignedArray(TAlignedArray&& other) noexcept
+			: m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+		{
+			other.m_data = nullptr;
+			other.m_size = 0;
+			other.m_capacity = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacion de copia.
+		 */
+		TAlignedArray& operator=(const TAlignedArray& other)
+		{
+			if (this != &other)
+			{
+				resize(other.m_size);
+				if (m_size > 0)
+				{
+					std::memcpy(m_data, other.m_data, m_size * sizeof(T));
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacion de movimiento.
+		 */
+		TAlignedArray& operator=(TAlignedArray&& other) noexcept
+		{
+			if (this != &other)
+			{
+				freeMemory(m_data);
+				m_data = other.m_data;
+				m_size = other.m_size;
+				m_capacity = other.m_capacity;
+				other.m_data = nullptr;
+				other.m_size = 0;
+				other.m_capacity = 0;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor. Libera el bloque alineado.
+		 */
+		~TAlignedArray() { freeMemory(m_data); }
+
+		/**
+		 * @brief Cambia el numero de elementos. Los elementos nuevos quedan en cero.
+		 *
+		 * @param count Nuevo numero de elementos.
+		 */
+		void resize(std::size_t count)
+		{
+			reserve(count);
+			if (count > m_size)
+			{
+				std::memset(static_cast<void*>(m_data + m_size), 0, (count - m_size) * sizeof(T));
+			}
+			m_size = count;
+		}
+
+		/**
+		 * @brief Reserva memoria para al menos count elementos sin cambiar el tamano.
+		 *
+		 * La capacidad se redondea a un multiplo de la alineacion para que los kernels
+		 * puedan leer vectores completos al final del arreglo.
+		 *
+		 * @param count Numero minimo de elementos.
+		 */
+		void reserve(std::size_t count)
+		{
+			if (count <= m_capacity)
+			{
+				return;
+			}
+
+			std::size_t newCapacity = m_capacity * 2 > count ? m_capacity * 2 : count;
+			const std::size_t perBlock = Alignment / sizeof(T) > 0 ? Alignment / sizeof(T) : 1;
+			newCapacity = (newCapacity + perBlock - 1) / perBlock * perBlock;
+
+			T* newData = allocateMemory(newCapacity);
+			if (m_size > 0)
+			{
+				std::memcpy(newData, m_data, m_size * sizeof(T));
+			}
+			freeMemory(m_data);
+			m_data = newData;
+			m_capacity = newCapacity;
+		}
+
+		/**
+		 * @brief Agrega un elemento al final.
+		 */
+		void push_back(const T& value)
+		{
+			reserve(m_size + 1);
+			m_data[m_size++] = value;
+		}
+
+		/**
+		 * @brief Elimina el ultimo elemento.
+		 */
+		void pop_back() { --m_size; }
+
+		/**
+		 * @brief Vacia el arreglo sin liberar la memoria.
+		 */
+		void clear() { m_size = 0; }
+
+		T& operator[](std::size_t index) { return m_data[index]; }
+		const T& operator[](std::size_t index) const { return m_data[index]; }
+
+		T* data() { return m_data; }
+		const T* data() const { return m_data; }
+
+		std::size_t size() const { return m_size; }
+		std::size_t capacity() const { return m_capacity; }
+		bool empty() const { return m_size == 0; }
+
+	private:
+		static T* allocateMemory(std::size_t count)
+		{
+			void* memory = ::operator new(count * sizeof(T), std::align_val_t(Alignment));
+			return static_cast<T*>(memory);
+		}
+
+		static void freeMemory(T* memory)
+		{
+			if (memory != nullptr)
+			{
+				::operator delete(memory, std::align_val_t(Alignment));
+			}
+		}
+
+		T* m_data = nullptr;         ///< Bloque alineado.
+		std::size_t m_size = 0;      ///< Elementos en uso.
+		std::size_t m_capacity = 0;  ///< Elementos reservados.
+	};
+}
@@ -0,0 +1,289 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "Math/VectorStream.h"
+
+/**
+ * @file CollisionWorld.h
+ * @brief Declares the collision pipeline: SoA body storage, a sweep-and-prune broadphase
+ * and SAT narrowphase tests for circles, boxes and convex polygons.
+ */
+
+class CShape;
+
+/**
+ * @brief Stable handle of a body in a CollisionWorld.
+ */
+typedef uint32_t BodyId;
+
+/**
+ * @enum ColliderType
+ * @brief Geometry of a collision body.
+ */
+enum
+    ColliderType {
+    COLLIDER_CIRCLE = 0, ///< Circle with a radius.
+    COLLIDER_BOX = 1,    ///< Rectangle centered on the body position.
+    COLLIDER_CONVEX = 2  ///< Convex polygon with up to CollisionWorld::kMaxPolygonVertices vertices.
+};
+
+/**
+ * @struct Contact
+ * @brief Overlapping pair found by CollisionWorld::step().
+ */
+struct
+    Contact {
+    BodyId a;            ///< First body.
+    BodyId b;            ///< Second body.
+    sf::Vector2f normal; ///< Unit separation axis pointing from a to b.
+    float depth;         ///< Penetration along the normal. Moving b by normal * depth separates the pair.
+};
+
+/**
+ * @struct CollisionStats
+ * @brief Work done by the last CollisionWorld::step().
+ */
+struct
+    CollisionStats {
+    std::size_t bodies = 0;         ///< Bodies in the world.
+    std::size_t candidatePairs = 0; ///< Pairs whose bounding boxes overlap.
+    std::size_t contacts = 0;       ///< Pairs that really overlap.
+};
+
+/**
+ * @class CollisionWorld
+ * @brief Finds every overlapping pair of bodies once per step.
+ *
+ * Bodies live in dense structure-of-arrays storage indexed by a sparse handle table, so
+ * removal is a swap with the last body. step() runs in three passes over that storage:
+ * - update: one VectorMath::sinCos batch for all rotations, then world vertices and AABBs;
+ * - broadphase: sweep and prune along the axis with the largest spread, keeping the sort
+ *   order from the previous step so coherent motion costs an almost linear insertion sort;
+ * - narrowphase: SAT tests dispatched on the collider types of each candidate pair.
+ *
+ * No virtual calls are made per body or per pair.
+ */
+class
+    CollisionWorld {
+public:
+    static constexpr std::size_t kMaxPolygonVertices = 8; ///< Vertex limit of a convex collider.
+    static constexpr BodyId kInvalidBody = 0xFFFFFFFFu;    ///< Returned when a body cannot be built.
+
+    CollisionWorld() = default;
+
+    ~CollisionWorld() = default;
+
+    /**
+     * @brief Adds a circle.
+     *
+     * @param position Center of the circle.
+     * @param radius Radius of the circle.
+     * @param userData Value returned by getUserData(), e.g. an entity ID.
+     */
+    BodyId
+        addCircle(const sf::Vector2f& position, float radius, uint32_t userData = 0);
+
+    /**
+     * @brief Adds a rectangle centered on its position.
+     *
+     * @param position Center of the rectangle.
+     * @param halfExtents Half width and half height.
+     * @param rotation Rotation in degrees.
+     * @param userData Value returned by getUserData().
+     */
+    BodyId
+        addBox(const sf::Vector2f& position, const sf::Vector2f& halfExtents, float rotation = 0.f,
+            uint32_t userData = 0);
+
+    /**
+     * @brief Adds a convex polygon.
+     *
+     * With fewer than 3 points it logs an error and returns kInvalidBody. With more than
+     * kMaxPolygonVertices points the collider is the bounding box of the points.
+     *
+     * @param position Position of the polygon origin.
+     * @param points Vertices relative to the origin, convex, in either winding order.
+     * @param rotation Rotation in degrees around the origin.
+     * @param userData Value returned by getUserData().
+     */
+    BodyId
+        addConvex(const sf::Vector2f& position, const std::vector<sf::Vector2f>& points,
+            float rotation = 0.f, uint32_t userData = 0);
+
+    /**
+     * @brief Adds a body that matches the geometry of a CShape.
+     *
+     * Circles become circle colliders, every other shape a convex polygon built from
+     * the shape points. The collider origin is the shape origin, as in the render transform.
+     * Shapes with more than kMaxPolygonVertices points collide as their bounding box. An
+     * uninitialized shape logs an error and returns kInvalidBody.
+     */
+    BodyId
+        addShape(const CShape& shape, const sf::Vector2f& position, float rotation = 0.f,
+            uint32_t userData = 0);
+
+    /**
+     * @brief Removes a body. Its handle becomes invalid and may be reused. kInvalidBody is ignored.
+     */
+    void
+        removeBody(BodyId id);
+
+    /**
+     * @brief Moves a body.
+     */
+    void
+        setPosition(BodyId id, const sf::Vector2f& position) { m_positions.set(m_sparse[id], position); }
+
+    /**
+     * @brief Rotates a body, in degrees.
+     */
+    void
+        setRotation(BodyId id, float rotation) { m_rotations[m_sparse[id]] = rotation; }
+
+    sf::Vector2f
+        getPosition(BodyId id) const { return m_positions.get(m_sparse[id]); }
+
+    float
+        getRotation(BodyId id) const { return m_rotations[m_sparse[id]]; }
+
+    uint32_t
+        getUserData(BodyId id) const { return m_userData[m_sparse[id]]; }
+
+    ColliderType
+        getType(BodyId id) const { return m_types[m_sparse[id]]; }
+
+    /**
+     * @brief World bounding box of a body as of the last step().
+     */
+    sf::FloatRect
+        getBounds(BodyId id) const;
+
+    /**
+     * @brief Updates world geometry and finds every overlapping pair.
+     *
+     * @return Contacts of this step, also available from getContacts().
+     */
+    const std::vector<Contact>&
+        step();
+
+    /**
+     * @brief Contacts found by the last step().
+     */
+    const std::vector<Contact>&
+        getContacts() const { return m_contacts; }
+
+    /**
+     * @brief Counters of the last step().
+     */
+    const CollisionStats&
+        getStats() const { return m_stats; }
+
+    /**
+     * @brief Number of bodies.
+     */
+    std::size_t
+        getBodyCount() const { return m_ids.size(); }
+
+private:
+    static constexpr uint32_t kNoPolygon = 0xFFFFFFFFu; ///< m_polygonIndex of a circle.
+
+    /**
+     * @struct Polygon
+     * @brief Vertices and edge normals of a convex collider, local and in world space.
+     */
+    struct
+        Polygon {
+        uint32_t count = 0;                                  ///< Number of vertices.
+        uint32_t owner = 0;                                  ///< Dense index of the body.
+        sf::Vector2f local[kMaxPolygonVertices];             ///< Vertices, counter-clockwise.
+        sf::Vector2f localNormals[kMaxPolygonVertices];      ///< Outward normal of edge i -> i + 1.
+        sf::Vector2f world[kMaxPolygonVertices];             ///< Vertices after the last step().
+        sf::Vector2f worldNormals[kMaxPolygonVertices];      ///< Normals after the last step().
+    };
+
+    /**
+     * @brief Appends a body to the dense arrays and returns its handle.
+     */
+    BodyId
+        createBody(ColliderType type, const sf::Vector2f& position, float rotation, uint32_t userData);
+
+    /**
+     * @brief Adds a circle whose center is offset from the body origin.
+     */
+    BodyId
+        createCircle(const sf::Vector2f& position, const sf::Vector2f& localCenter, float radius,
+            float rotation, uint32_t userData);
+
+    /**
+     * @brief Adds a convex body, or its bounding box if it has too many vertices.
+     */
+    BodyId
+        createConvex(ColliderType type, const sf::Vector2f& position, const sf::Vector2f* points,
+            std::size_t count, float rotation, uint32_t userData);
+
+    /**
+     * @brief Creates the polygon of a body from local points.
+     */
+    void
+        createPolygon(uint32_t body, const sf::Vector2f* points, std::size_t count);
+
+    /**
+     * @brief Computes world centers, vertices and AABBs of every body.
+     */
+    void
+        updateGeometry();
+
+    /**
+     * @brief Sweep and prune: fills m_pairs with dense index pairs whose AABBs overlap.
+     */
+    void
+        findCandidatePairs();
+
+    /**
+     * @brief Runs the SAT test of one candidate pair and appends a contact if they overlap.
+     */
+    void
+        testPair(uint32_t a, uint32_t b);
+
+    bool
+        circleCircle(uint32_t a, uint32_t b, Contact& contact) const;
+
+    bool
+        polygonCircle(uint32_t polygonBody, uint32_t circleBody, Contact& contact) const;
+
+    bool
+        polygonPolygon(uint32_t a, uint32_t b, Contact& contact) const;
+
+    // Almacenamiento denso, un elemento por cuerpo
+    Vector2Stream m_positions;                       ///< Posicion de cada cuerpo.
+    EngineUtilities::TAlignedArray<float> m_rotations; ///< Rotacion en grados.
+    EngineUtilities::TAlignedArray<float> m_radii;   ///< Radio de los circulos.
+    Vector2Stream m_localCenters;                    ///< Centro de los circulos relativo al origen.
+    Vector2Stream m_centers;                         ///< Centro en mundo de los circulos.
+    EngineUtilities::TAlignedArray<float> m_minX;    ///< AABB en mundo.
+    EngineUtilities::TAlignedArray<float> m_minY;
+    EngineUtilities::TAlignedArray<float> m_maxX;
+    EngineUtilities::TAlignedArray<float> m_maxY;
+    std::vector<ColliderType> m_types;               ///< Tipo de colisionador.
+    std::vector<uint32_t> m_polygonIndex;            ///< Poligono de cada cuerpo, o kNoPolygon.
+    std::vector<uint32_t> m_userData;                ///< Dato de usuario.
+    std::vector<BodyId> m_ids;                       ///< Handle de cada indice denso.
+
+    std::vector<Polygon> m_polygons;                 ///< Poligonos densos.
+    std::vector<uint32_t> m_sparse;                  ///< Indice denso por handle.
+    std::vector<BodyId> m_freeIds;                   ///< Handles libres.
+
+    // Datos temporales de step()
+    EngineUtilities::TAlignedArray<float> m_angles;  ///< Rotaciones en radianes.
+    EngineUtilities::TAlignedArray<float> m_sines;
+    EngineUtilities::TAlignedArray<float> m_cosines;
+    std::vector<uint32_t> m_order;                   ///< Orden de barrido, persistente entre pasos.
+    EngineUtilities::TAlignedArray<float> m_sortedMin;      ///< Intervalos en orden de barrido.
+    EngineUtilities::TAlignedArray<float> m_sortedMax;
+    EngineUtilities::TAlignedArray<float> m_sortedOtherMin;
+    EngineUtilities::TAlignedArray<float> m_sortedOtherMax;
+    std::vector<uint32_t> m_strip;                   ///< Solapes de la franja actual.
+    std::vector<std::pair<uint32_t, uint32_t>> m_pairs; ///< Pares candidatos.
+    std::vector<Contact> m_contacts;                 ///< Contactos del ultimo paso.
+    CollisionStats m_stats;                          ///< Contadores del ultimo paso.
+    int m_sweepAxis = 0;                             ///< Eje de barrido del ultimo paso.
+};
@@ -0,0 +1,164 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "Math/VectorStream.h"
+
+/**
+ * @file SpatialHash.h
+ * @brief Declares the SpatialHash, a uniform grid of hashed cells for radius, box and nearest-neighbor queries.
+ */
+
+class ThreadPool;
+class Transform;
+
+/**
+ * @class SpatialHash
+ * @brief Uniform grid over point positions, rebuilt from scratch every frame.
+ *
+ * build() hashes every point to a cell and groups the points by bucket with a counting
+ * sort, so each bucket is one contiguous run of the sorted position arrays. Queries only
+ * read that storage: any number of threads may query the same hash between two builds.
+ *
+ * Items are identified by their index in the input of build().
+ */
+class
+    SpatialHash {
+public:
+    static constexpr uint32_t kNoItem = 0xFFFFFFFFu; ///< "No item" for the exclude parameters.
+
+    /**
+     * @brief Creates an empty hash.
+     *
+     * @param cellSize Edge of a grid cell. About the typical query radius works best.
+     */
+    explicit SpatialHash(float cellSize = 64.f);
+
+    ~SpatialHash() = default;
+
+    /**
+     * @brief Rebuilds the grid from raw coordinate arrays.
+     *
+     * @param x X coordinates.
+     * @param y Y coordinates.
+     * @param count Number of points.
+     */
+    void
+        build(const float* x, const float* y, std::size_t count);
+
+    /**
+     * @brief Rebuilds the grid from a position stream.
+     */
+    void
+        build(const Vector2Stream& positions) { build(positions.x(), positions.y(), positions.size()); }
+
+    /**
+     * @brief Rebuilds the grid from the positions of Transform components.
+     *
+     * Item i is transforms[i].
+     */
+    void
+        build(const std::vector<const Transform*>& transforms);
+
+    /**
+     * @brief Appends the items within @p radius of @p center to @p out.
+     *
+     * @param exclude Item to skip, e.g. the one asking.
+     */
+    void
+        queryRadius(const sf::Vector2f& center, float radius, std::vector<uint32_t>& out,
+            uint32_t exclude = kNoItem) const;
+
+    /**
+     * @brief Appends the items inside a rectangle (edges included) to @p out.
+     */
+    void
+        queryAABB(const sf::FloatRect& rect, std::vector<uint32_t>& out) const;
+
+    /**
+     * @brief Replaces @p out with the @p k items closest to @p center, nearest first.
+     *
+     * Rings of cells are visited outwards until no closer item can exist.
+     *
+     * @param exclude Item to skip, e.g. the one asking.
+     */
+    void
+        queryNearest(const sf::Vector2f& center, std::size_t k, std::vector<uint32_t>& out,
+            uint32_t exclude = kNoItem) const;
+
+    /**
+     * @brief Runs one radius query per center on the pool.
+     *
+     * @param centers Query centers.
+     * @param radius Radius shared by every query.
+     * @param results Resized to centers.size(); results[i] receives the items of query i.
+     * Keeping the vector between frames reuses its allocations.
+     * @param excludeSelf Skip item i in query i, for queries made by the items themselves.
+     */
+    void
+        queryRadiusBatch(const std::vector<sf::Vector2f>& centers, float radius,
+            std::vector<std::vector<uint32_t>>& results, ThreadPool& pool, bool excludeSelf = false) const;
+
+    /**
+     * @brief Runs one k-nearest query per center on the pool.
+     */
+    void
+        queryNearestBatch(const std::vector<sf::Vector2f>& centers, std::size_t k,
+            std::vector<std::vector<uint32_t>>& results, ThreadPool& pool, bool excludeSelf = false) const;
+
+    /**
+     * @brief Position of an item as passed to build().
+     */
+    sf::Vector2f
+        getPosition(uint32_t item) const { return sf::Vector2f(m_x[item], m_y[item]); }
+
+    /**
+     * @brief Number of points in the last build().
+     */
+    std::size_t
+        size() const { return m_x.size(); }
+
+    float
+        getCellSize() const { return m_cellSize; }
+
+private:
+    /**
+     * @brief Buckets the points already copied into m_x and m_y.
+     */
+    void
+        rebuild();
+
+    /**
+     * @brief Integer cell coordinate of a world coordinate.
+     */
+    int32_t
+        cellCoord(float value) const;
+
+    /**
+     * @brief Bucket of a cell in the hash table.
+     */
+    uint32_t
+        bucketOf(int32_t cellX, int32_t cellY) const;
+
+    /**
+     * @brief Calls visit(sortedIndex) for every point stored in cell (cellX, cellY).
+     */
+    template<typename Visitor>
+    void
+        forEachInCell(int32_t cellX, int32_t cellY, Visitor&& visit) const;
+
+    float m_cellSize;         ///< Edge of a cell.
+    float m_inverseCellSize;  ///< 1 / m_cellSize.
+    uint32_t m_bucketMask = 0;///< Table size - 1, the table size being a power of two.
+
+    EngineUtilities::TAlignedArray<float> m_x;        ///< Posiciones de entrada, por item.
+    EngineUtilities::TAlignedArray<float> m_y;
+    EngineUtilities::TAlignedArray<float> m_sortedX;  ///< Posiciones ordenadas por bucket.
+    EngineUtilities::TAlignedArray<float> m_sortedY;
+    std::vector<uint32_t> m_sortedItems;              ///< Item de cada posicion ordenada.
+    std::vector<uint64_t> m_sortedCells;              ///< Celda de cada posicion ordenada.
+    std::vector<uint32_t> m_bucketStart;              ///< Inicio de cada bucket, mas un final.
+    std::vector<uint32_t> m_itemBuckets;              ///< Bucket de cada item durante build().
+    int32_t m_minCellX = 0;                           ///< Celdas ocupadas, para acotar queryNearest.
+    int32_t m_minCellY = 0;
+    int32_t m_maxCellX = -1;
+    int32_t m_maxCellY = -1;
+};
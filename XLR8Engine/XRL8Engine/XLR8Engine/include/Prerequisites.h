@@ -14,10 +14,13 @@
 #include <map>          ///< Sorted associative container.
 #include <fstream>      ///< File input/output.
 #include <unordered_map>///< Hash table-based associative container.
+#include <cstdlib>      ///< std::exit.
 
 #include <Memory/TSharedPointer.h>
 #include <Memory/TStaticPtr.h>
 #include <Memory/TUniquePtr.h>
+#include <Core/Logger.h>
+#include <Core/Profiler.h>
 
 
 
@@ -35,35 +38,54 @@
 #define SAFE_PTR_RELEASE(x) if(x != nullptr) { delete x; x = nullptr; }
 
  /**
-  * @brief Logs a resource creation message to standard error.
+  * @brief Logs a resource creation message through the asynchronous Logger.
   *
   * @param classObj Name of the class.
   * @param method Name of the method.
   * @param state Message indicating resource state.
   */
-#define MESSAGE(classObj, method, state)                      \
-{                                                             \
-    std::ostringstream os_;                                   \
-    os_ << classObj << "::" << method << " : "                \
-        << "[CREATION OF RESOURCE" << ": " << state "] \n";   \
-    std::cerr << os_.str();                                   \
-}
+#define MESSAGE(classObj, method, state)                                  \
+    XLR8_LOG(LOG_INFO, classObj, XLR8_LOG_LITERAL("::"), method,          \
+        XLR8_LOG_LITERAL(" : [CREATION OF RESOURCE: "), state, XLR8_LOG_LITERAL("]"))
 
   /**
-   * @brief Logs an error message and terminates the program.
+   * @brief Logs a warning. The program keeps running.
+   *
+   * @param classObj Name of the class.
+   * @param method Name of the method.
+   * @param warningMSG Description of the problem.
+   */
+#define WARNING(classObj, method, warningMSG)                             \
+    XLR8_LOG(LOG_WARNING, classObj, XLR8_LOG_LITERAL("::"), method,       \
+        XLR8_LOG_LITERAL(" : "), warningMSG)
+
+  /**
+   * @brief Logs an error. The program keeps running, so the caller must recover.
+   *
+   * Safe to use in the frame loop: it queues the message and returns without I/O.
+   *
+   * @param classObj Name of the class.
+   * @param method Name of the method.
+   * @param errorMSG Description of the error.
+   */
+#define ERROR(classObj, method, errorMSG)                                 \
+    XLR8_LOG(LOG_ERROR, classObj, XLR8_LOG_LITERAL("::"), method,         \
+        XLR8_LOG_LITERAL(" : Error in data from params ["), errorMSG, XLR8_LOG_LITERAL("]"))
+
+  /**
+   * @brief Logs an unrecoverable error, waits for the log to be written and terminates
+   * the program.
    *
    * @param classObj Name of the class.
    * @param method Name of the method.
    * @param errorMSG Description of the error.
    */
-#define ERROR(classObj, method, errorMSG)                         \
-{                                                                 \
-    std::ostringstream os_;                                       \
-    os_ << "ERROR : " << classObj << "::" << method << " : "      \
-        << "  Error in data from params [" << errorMSG"] \n";     \
-    std::cerr << os_.str();                                       \
-    exit(1);                                                      \
-}
+#define FATAL(classObj, method, errorMSG)                                 \
+do {                                                                      \
+    Logger::get().write(LOG_FATAL, classObj, "::", method, " : ", errorMSG); \
+    Logger::get().flush();                                                \
+    std::exit(1);                                                         \
+} while (0)
 
    // === Enumerations ===
 
@@ -77,5 +99,32 @@ enum
     CIRCLE = 1,   ///< Circle shape.
     RECTANGLE = 2,///< Rectangle shape.
     TRIANGLE = 3, ///< Triangle shape using a convex polygon.
-    POLYGON = 4   ///< General polygon with 5 or more points.
+    POLYGON = 4   ///< General polygon, any simple outline through CShape::createPolygon.
+};
+
+/**
+ * @enum ComponentType
+ * @brief Types of components that can be attached to an entity.
+ */
+enum
+    ComponentType {
+    NONE = 0,     ///< Untyped component.
+    TRANSFORM = 1,///< Position, rotation and scale.
+    SHAPE = 2,    ///< Drawable 2D shape.
+    SPRITE = 3,   ///< Textured sprite from an atlas.
+    PARTICLE_EMITTER = 4,///< Spawns particles into a ParticleSystem.
+    BEHAVIOUR = 5 ///< Runs coroutine behaviours on a BehaviourScheduler.
+};
+
+/**
+ * @enum ComponentHook
+ * @brief Lifecycle hooks of a component. Entity keeps one list per hook.
+ */
+enum
+    ComponentHook {
+    HOOK_START = 0,   ///< Component::start().
+    HOOK_UPDATE = 1,  ///< Component::update().
+    HOOK_RENDER = 2,  ///< Component::render().
+    HOOK_DESTROY = 3, ///< Component::destroy().
+    COMPONENT_HOOK_COUNT = 4
 };
\ No newline at end of file
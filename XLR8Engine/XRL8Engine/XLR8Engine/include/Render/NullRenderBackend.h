@@ -0,0 +1,63 @@
+#pragma once
+#include "RenderBackend.h"
+
+/**
+ * @file NullRenderBackend.h
+ * @brief Declares a render backend that only records counters, for headless runs and benchmarks.
+ */
+
+ /**
+  * @class NullRenderBackend
+  * @brief Render backend that never touches OpenGL.
+  *
+  * Draws, clears and presents only update the RenderStats counters. The backend
+  * closes itself after a fixed number of frames so the BaseApp loop terminates.
+  * Events queued with queueEvent() are returned by pollEvent(), which is how a replay
+  * feeds recorded input through the normal Window::handleEvents path.
+  */
+class
+    NullRenderBackend : public RenderBackend {
+public:
+    /**
+     * @brief Constructs the backend.
+     *
+     * @param maxFrames Frames to present before closing. 0 runs until close() is called.
+     */
+    explicit NullRenderBackend(uint64_t maxFrames = 0) : m_maxFrames(maxFrames) {}
+
+    bool
+        isOpen() const override { return m_open; }
+
+    bool
+        pollEvent(sf::Event& event) override;
+
+    void
+        close() override { m_open = false; }
+
+    void
+        clear(const sf::Color& color) override;
+
+    void
+        draw(const sf::Drawable& drawable, const sf::RenderStates& states) override;
+
+    void
+        draw(const sf::Vertex* vertices,
+            std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states) override;
+
+    void
+        display() override;
+
+    /**
+     * @brief Adds an event for the next pollEvent() calls, in order.
+     */
+    void
+        queueEvent(const sf::Event& event) { m_events.push_back(event); }
+
+private:
+    uint64_t m_maxFrames = 0; ///< Frames to present before closing (0 = unlimited).
+    bool m_open = true;       ///< Whether the backend still accepts frames.
+    std::vector<sf::Event> m_events; ///< Eventos encolados por queueEvent().
+    std::size_t m_nextEvent = 0;     ///< Siguiente evento a devolver.
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "Math/VectorStream.h"
+#include "Render/RenderQueue.h"
+
+/**
+ * @file ParticleSystem.h
+ * @brief Declares the ParticleSystem, a pool of short-lived quads stored as structure of arrays.
+ */
+
+class ThreadPool;
+
+/**
+ * @struct ParticleStats
+ * @brief Counters of a ParticleSystem.
+ */
+struct
+    ParticleStats {
+    std::size_t alive = 0;   ///< Particles alive after the last update().
+    uint64_t spawned = 0;    ///< Particles created since construction.
+    uint64_t expired = 0;    ///< Particles removed because their lifetime ran out.
+    uint64_t dropped = 0;    ///< Spawns refused because the pool was full.
+};
+
+/**
+ * @class ParticleSystem
+ * @brief Simulates and draws many particles with SIMD kernels.
+ *
+ * Position, velocity, remaining life, inverse lifetime, size and color each live in their
+ * own aligned array. update() integrates all particles with VectorMath::integrate and
+ * VectorMath::addScalar, then swap-removes the dead ones so the arrays stay dense.
+ * render() writes every particle as two triangles straight into one RenderQueue
+ * allocation, so the whole system is a single batch. Both passes can be split across a
+ * ThreadPool.
+ *
+ * Particles fade out: the alpha of each particle is scaled by its remaining life fraction.
+ * CParticleEmitter components spawn into a shared system.
+ */
+class
+    ParticleSystem {
+public:
+    /**
+     * @brief Creates an empty system.
+     *
+     * @param maxParticles Pool capacity. Spawns beyond it are dropped.
+     */
+    explicit ParticleSystem(std::size_t maxParticles = 1 << 20);
+
+    ~ParticleSystem() = default;
+
+    /**
+     * @brief Adds a particle.
+     *
+     * @param position Start position.
+     * @param velocity Start velocity in units per second.
+     * @param lifetime Seconds until the particle expires. Must be positive.
+     * @param size Edge of the particle quad.
+     * @param color Color at spawn. Alpha fades to zero over the lifetime.
+     * @return false if the pool is full.
+     */
+    bool
+        spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float lifetime,
+            float size, const sf::Color& color);
+
+    /**
+     * @brief Advances every particle and removes the expired ones.
+     *
+     * @param deltaTime Seconds since the last update.
+     * @param pool Optional pool that integrates chunks of particles in parallel.
+     */
+    void
+        update(float deltaTime, ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Submits every particle to the queue as one batch of triangles.
+     *
+     * @param queue Queue of the window the particles are drawn in.
+     * @param pool Optional pool that builds chunks of vertices in parallel.
+     */
+    void
+        render(RenderQueue& queue, ThreadPool* pool = nullptr) const;
+
+    /**
+     * @brief Removes every particle.
+     */
+    void
+        clear();
+
+    /**
+     * @brief Acceleration applied to every particle, e.g. gravity.
+     */
+    void
+        setAcceleration(const sf::Vector2f& acceleration) { m_acceleration = acceleration; }
+
+    /**
+     * @brief Fraction of the velocity kept per update, 1 for none lost.
+     */
+    void
+        setDamping(float damping) { m_damping = damping; }
+
+    /**
+     * @brief Draw layer, depth and blend mode of the batch.
+     */
+    void
+        setRenderState(uint8_t layer, float depth, BlendType blendType);
+
+    std::size_t
+        size() const { return m_positions.size(); }
+
+    std::size_t
+        capacity() const { return m_maxParticles; }
+
+    const ParticleStats&
+        getStats() const { return m_stats; }
+
+    /**
+     * @brief Positions of the live particles, e.g. to feed a SpatialHash.
+     */
+    const Vector2Stream&
+        getPositions() const { return m_positions; }
+
+private:
+    /**
+     * @brief Swap-removes every particle whose life ran out.
+     */
+    void
+        removeExpired();
+
+    /**
+     * @brief Writes the six vertices of particles [begin, end) to @p vertices.
+     */
+    void
+        buildVertices(std::size_t begin, std::size_t end, sf::Vertex* vertices) const;
+
+    std::size_t m_maxParticles;                          ///< Capacidad del pool.
+    Vector2Stream m_positions;                           ///< Posicion de cada particula.
+    Vector2Stream m_velocities;                          ///< Velocidad de cada particula.
+    EngineUtilities::TAlignedArray<float> m_life;        ///< Segundos de vida restantes.
+    EngineUtilities::TAlignedArray<float> m_inverseLifetime; ///< 1 / vida total.
+    EngineUtilities::TAlignedArray<float> m_sizes;       ///< Lado del cuadrado.
+    EngineUtilities::TAlignedArray<sf::Color> m_colors;  ///< Color inicial.
+
+    sf::Vector2f m_acceleration;                         ///< Aceleracion comun, p. ej. gravedad.
+    float m_damping = 1.f;                               ///< Velocidad conservada por paso.
+    uint8_t m_layer = 0;                                 ///< Capa de dibujo.
+    float m_depth = 0.f;                                 ///< Profundidad dentro de la capa.
+    BlendType m_blendType = BLEND_ADD;                   ///< Modo de mezcla.
+    ParticleStats m_stats;                               ///< Contadores.
+};
@@ -0,0 +1,150 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file RenderBackend.h
+ * @brief Declares the RenderBackend interface used by Window to clear, draw and present frames.
+ */
+
+ /**
+  * @struct RenderStats
+  * @brief Counters recorded by a render backend.
+  */
+struct
+    RenderStats {
+    uint64_t drawCalls = 0;    ///< Number of draw submissions.
+    uint64_t vertices = 0;     ///< Number of vertices submitted.
+    uint64_t stateChanges = 0; ///< Texture, shader or blend mode switches between draws.
+    uint64_t clears = 0;       ///< Number of clear calls.
+    uint64_t frames = 0;       ///< Number of presented frames.
+
+    /**
+     * @brief Sets every counter back to zero.
+     */
+    void
+        reset() { *this = RenderStats(); }
+};
+
+/**
+ * @class RenderBackend
+ * @brief Abstract target behind Window::clear, Window::draw and Window::display.
+ *
+ * Every backend records the same counters, so statistics from a headless run
+ * can be compared directly with those of an SFML window.
+ */
+class
+    RenderBackend {
+public:
+    virtual
+        ~RenderBackend() = default;
+
+    /**
+     * @brief Checks if the backend still accepts frames.
+     */
+    virtual bool
+        isOpen() const = 0;
+
+    /**
+     * @brief Pops the next pending event.
+     *
+     * @param event Receives the event.
+     * @return true if an event was written, false if the queue is empty.
+     */
+    virtual bool
+        pollEvent(sf::Event& event) = 0;
+
+    /**
+     * @brief Stops accepting frames. isOpen returns false afterwards.
+     */
+    virtual void
+        close() = 0;
+
+    /**
+     * @brief Clears the render target.
+     *
+     * @param color Clear color.
+     */
+    virtual void
+        clear(const sf::Color& color) = 0;
+
+    /**
+     * @brief Draws an SFML drawable.
+     *
+     * @param drawable Object to draw.
+     * @param states Render states for the draw.
+     */
+    virtual void
+        draw(const sf::Drawable& drawable, const sf::RenderStates& states) = 0;
+
+    /**
+     * @brief Draws a raw vertex range.
+     *
+     * @param vertices Pointer to the first vertex.
+     * @param vertexCount Number of vertices.
+     * @param type Primitive type of the range.
+     * @param states Render states for the draw.
+     */
+    virtual void
+        draw(const sf::Vertex* vertices,
+            std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states) = 0;
+
+    /**
+     * @brief Presents the frame and rolls the per-frame counters.
+     */
+    virtual void
+        display() = 0;
+
+    /**
+     * @brief Counters of the last presented frame.
+     */
+    const RenderStats&
+        getFrameStats() const { return m_lastFrameStats; }
+
+    /**
+     * @brief Counters accumulated since the backend was created.
+     */
+    const RenderStats&
+        getTotalStats() const { return m_totalStats; }
+
+protected:
+    /**
+     * @brief Records a draw submission and detects render state changes.
+     *
+     * @param vertexCount Number of vertices submitted.
+     * @param states Render states of the draw.
+     */
+    void
+        recordDraw(std::size_t vertexCount, const sf::RenderStates& states);
+
+    /**
+     * @brief Records a clear call.
+     */
+    void
+        recordClear();
+
+    /**
+     * @brief Records a presented frame and resets the per-frame counters.
+     */
+    void
+        recordDisplay();
+
+    /**
+     * @brief Returns how many vertices SFML will submit for a drawable.
+     *
+     * Shapes, vertex arrays and sprites are counted exactly; other drawables count as zero.
+     */
+    static std::size_t
+        countVertices(const sf::Drawable& drawable);
+
+private:
+    RenderStats m_frameStats;     ///< Counters of the frame being built.
+    RenderStats m_lastFrameStats; ///< Counters of the last presented frame.
+    RenderStats m_totalStats;     ///< Counters since creation.
+
+    bool m_hasLastState = false;                  ///< Whether a draw was recorded this frame.
+    const sf::Texture* m_lastTexture = nullptr;   ///< Texture of the previous draw.
+    const sf::Shader* m_lastShader = nullptr;     ///< Shader of the previous draw.
+    sf::BlendMode m_lastBlendMode;                ///< Blend mode of the previous draw.
+};
@@ -0,0 +1,249 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file RenderQueue.h
+ * @brief Declares the RenderQueue, which sorts draw items by a packed 64-bit key and merges them into batches.
+ */
+
+class Window;
+
+/**
+ * @enum BlendType
+ * @brief Blend modes that can be encoded in a render key.
+ */
+enum
+    BlendType {
+    BLEND_ALPHA = 0,    ///< Standard alpha blending.
+    BLEND_ADD = 1,      ///< Additive blending.
+    BLEND_MULTIPLY = 2, ///< Multiplicative blending.
+    BLEND_NONE = 3      ///< Opaque, no blending.
+};
+
+/**
+ * @class RenderKey
+ * @brief Packs and unpacks the 64-bit sort key of a draw item.
+ *
+ * Layout, from the most significant bit:
+ * | layer (8) | translucent (1) | blend (3) | material (20) | depth (32) |  opaque items
+ * | layer (8) | translucent (1) | depth (32) | blend (3) | material (20) |  blended items
+ *
+ * Layers give a strict draw order. Inside a layer, opaque items (BLEND_NONE) come first,
+ * grouped by material so they merge into as few batches as possible. Blended items follow,
+ * ordered by depth across every blend mode and material, so they composite back to front;
+ * only neighbours at the same depth with the same state merge.
+ */
+class
+    RenderKey {
+public:
+    static constexpr uint32_t kMaxMaterials = 1u << 20; ///< Number of material IDs the key can hold.
+    static constexpr uint64_t kTranslucentBit = 1ull << 55; ///< Set for every blend mode but BLEND_NONE.
+
+    /**
+     * @brief Builds a sort key.
+     *
+     * @param layer Draw layer; higher layers are drawn on top.
+     * @param blend Blend mode of the item.
+     * @param materialId Texture/shader ID from RenderQueue::getMaterialId.
+     * @param depth Depth inside the layer; lower depths are drawn first.
+     */
+    static uint64_t
+        make(uint8_t layer, BlendType blend, uint32_t materialId, float depth);
+
+    /**
+     * @brief Returns the bits that decide whether two items can share a batch.
+     */
+    static uint32_t
+        stateBits(uint64_t key) { return (static_cast<uint32_t>(blend(key)) << 20) | material(key); }
+
+    /**
+     * @brief Extracts the blend mode of a key.
+     */
+    static BlendType
+        blend(uint64_t key) {
+        return static_cast<BlendType>((isTranslucent(key) ? key >> 20 : key >> 52) & 0x7u);
+    }
+
+    /**
+     * @brief Extracts the material ID of a key.
+     */
+    static uint32_t
+        material(uint64_t key) {
+        return static_cast<uint32_t>(isTranslucent(key) ? key : key >> 32) & (kMaxMaterials - 1);
+    }
+
+    /**
+     * @brief Whether the key uses the depth-first layout of blended items.
+     */
+    static bool
+        isTranslucent(uint64_t key) { return (key & kTranslucentBit) != 0; }
+
+    /**
+     * @brief Extracts the layer of a key.
+     */
+    static uint8_t
+        layer(uint64_t key) { return static_cast<uint8_t>(key >> 56); }
+};
+
+/**
+ * @struct RenderQueueStats
+ * @brief Counters of the last RenderQueue::flush.
+ */
+struct
+    RenderQueueStats {
+    uint32_t items = 0;   ///< Items submitted.
+    uint32_t batches = 0; ///< Draw calls issued.
+};
+
+/**
+ * @class RenderQueue
+ * @brief Collects the draw items of a frame, radix-sorts them by key and draws them in batches.
+ *
+ * Triangle items that end up next to each other with the same blend mode and material are
+ * merged into a single draw call. Drawables submitted as-is always get their own draw call.
+ */
+class
+    RenderQueue {
+public:
+    RenderQueue() = default;
+
+    ~RenderQueue() = default;
+
+    /**
+     * @brief Returns a dense ID for a texture/shader pair, creating it on first use.
+     *
+     * The pair (nullptr, nullptr) is always ID 0.
+     *
+     * @param texture Texture used by the items, or nullptr.
+     * @param shader Shader used by the items, or nullptr.
+     */
+    uint32_t
+        getMaterialId(const sf::Texture* texture, const sf::Shader* shader = nullptr);
+
+    /**
+     * @brief Reserves space for a triangle list and returns it for the caller to fill.
+     *
+     * The returned pointer is only valid until the next submission.
+     *
+     * @param key Sort key of the item.
+     * @param vertexCount Number of vertices, a multiple of 3.
+     * @param texture Texture sampled by the vertices, or nullptr.
+     * @param shader Shader used by the item, or nullptr.
+     * @return Pointer to vertexCount vertices.
+     */
+    sf::Vertex*
+        allocate(uint64_t key,
+            std::size_t vertexCount,
+            const sf::Texture* texture = nullptr,
+            const sf::Shader* shader = nullptr);
+
+    /**
+     * @brief Submits a triangle list, copying its vertices.
+     *
+     * @param key Sort key of the item.
+     * @param vertices Vertices of the triangles, already in world space.
+     * @param vertexCount Number of vertices, a multiple of 3.
+     * @param texture Texture sampled by the vertices, or nullptr.
+     * @param shader Shader used by the item, or nullptr.
+     */
+    void
+        submit(uint64_t key,
+            const sf::Vertex* vertices,
+            std::size_t vertexCount,
+            const sf::Texture* texture = nullptr,
+            const sf::Shader* shader = nullptr);
+
+    /**
+     * @brief Submits a drawable that is drawn on its own.
+     *
+     * The drawable must outlive the next flush.
+     *
+     * @param key Sort key of the item.
+     * @param drawable Object to draw.
+     * @param states Render states of the draw.
+     */
+    void
+        submit(uint64_t key, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+    /**
+     * @brief Sorts the submitted items and draws them, then empties the queue.
+     *
+     * @param window Window the batches are drawn into.
+     */
+    void
+        flush(Window& window);
+
+    /**
+     * @brief Drops every submitted item without drawing.
+     */
+    void
+        clear();
+
+    /**
+     * @brief Number of items submitted since the last flush.
+     */
+    std::size_t
+        size() const { return m_items.size(); }
+
+    /**
+     * @brief Counters of the last flush.
+     */
+    const RenderQueueStats&
+        getStats() const { return m_stats; }
+
+private:
+    /**
+     * @struct DrawItem
+     * @brief One submission: either a vertex range or a drawable.
+     */
+    struct
+        DrawItem {
+        const sf::Drawable* drawable = nullptr; ///< Drawable to draw, or nullptr for a vertex range.
+        const sf::Texture* texture = nullptr;   ///< Texture of the vertex range.
+        const sf::Shader* shader = nullptr;     ///< Shader of the vertex range.
+        uint32_t first = 0;                     ///< First vertex, or index into m_states for drawables.
+        uint32_t count = 0;                     ///< Number of vertices.
+    };
+
+    /**
+     * @struct SortEntry
+     * @brief Key and item index pair moved around by the radix sort.
+     */
+    struct
+        SortEntry {
+        uint64_t key;  ///< Sort key.
+        uint32_t item; ///< Index into m_items.
+    };
+
+    /**
+     * @brief Stable LSD radix sort of m_entries, skipping bytes that are equal in every key.
+     */
+    void
+        sort();
+
+    /**
+     * @brief Adds the vertices of an item to the pending batch. Items that follow each
+     * other in the vertex pool are drawn straight from it; only a batch of scattered items
+     * is gathered into m_batch.
+     */
+    void
+        appendToBatch(const DrawItem& item);
+
+    /**
+     * @brief Draws the pending batch, if any.
+     */
+    void
+        drawBatch(Window& window, BlendType blend, const DrawItem& item);
+
+    std::vector<DrawItem> m_items;           ///< Submitted items.
+    std::vector<SortEntry> m_entries;        ///< Keys of the submitted items.
+    std::vector<SortEntry> m_scratch;        ///< Ping-pong buffer for the radix sort.
+    std::vector<sf::Vertex> m_vertices;      ///< Vertex pool of the vertex-range items, kept across frames.
+    std::size_t m_vertexCount = 0;           ///< Vertices of the pool used this frame.
+    std::vector<sf::Vertex> m_batch;         ///< Gathered vertices of a batch of scattered items.
+    std::size_t m_batchFirst = 0;            ///< First pool vertex of the batch while it is contiguous.
+    std::size_t m_batchCount = 0;            ///< Vertices of the batch being built.
+    std::vector<sf::RenderStates> m_states;  ///< Render states of the drawable items.
+    std::map<std::pair<const sf::Texture*, const sf::Shader*>, uint32_t> m_materials; ///< Material IDs.
+    RenderQueueStats m_stats;                ///< Counters of the last flush.
+};
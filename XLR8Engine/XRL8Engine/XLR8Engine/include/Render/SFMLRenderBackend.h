@@ -0,0 +1,52 @@
+#pragma once
+#include "RenderBackend.h"
+#include "Memory/TUniquePtr.h"
+
+/**
+ * @file SFMLRenderBackend.h
+ * @brief Declares the render backend that draws into an sf::RenderWindow.
+ */
+
+ /**
+  * @class SFMLRenderBackend
+  * @brief Render backend wrapping an SFML render window.
+  */
+class
+    SFMLRenderBackend : public RenderBackend {
+public:
+    /**
+     * @brief Creates the SFML window.
+     *
+     * @param width Width of the window in pixels.
+     * @param height Height of the window in pixels.
+     * @param title Title of the window.
+     */
+    SFMLRenderBackend(int width, int height, const std::string& title);
+
+    bool
+        isOpen() const override;
+
+    bool
+        pollEvent(sf::Event& event) override;
+
+    void
+        close() override;
+
+    void
+        clear(const sf::Color& color) override;
+
+    void
+        draw(const sf::Drawable& drawable, const sf::RenderStates& states) override;
+
+    void
+        draw(const sf::Vertex* vertices,
+            std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states) override;
+
+    void
+        display() override;
+
+private:
+    EngineUtilities::TUniquePtr<sf::RenderWindow> m_windowPtr; ///< Unique pointer to the SFML render window.
+};
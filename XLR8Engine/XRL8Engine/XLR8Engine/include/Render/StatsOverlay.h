@@ -0,0 +1,59 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Core/Telemetry.h"
+#include <chrono>
+
+/**
+ * @file StatsOverlay.h
+ * @brief Declares the on-screen panel that shows a Telemetry registry.
+ */
+
+ /**
+  * @class StatsOverlay
+  * @brief Builds the vertices of a small stats panel drawn in the top-left corner.
+  *
+  * Text uses a built-in 5x7 pixel font, so the overlay needs no font file and draws as
+  * a single sf::Triangles range. The text is rebuilt a few times per second; the frames
+  * in between reuse the same vertices.
+  */
+class
+    StatsOverlay {
+public:
+    /**
+     * @brief Rebuilds the panel if the refresh interval has passed.
+     *
+     * @param telemetry Registry to show.
+     */
+    void
+        update(const Telemetry& telemetry);
+
+    /**
+     * @brief Vertices of the panel, as triangles in window coordinates.
+     */
+    const std::vector<sf::Vertex>&
+        getVertices() const { return m_vertices; }
+
+    /**
+     * @brief Size in window pixels of one font pixel. Defaults to 2.
+     */
+    void
+        setScale(float scale) { m_scale = scale; m_hasRefreshed = false; }
+
+private:
+    /**
+     * @brief Rebuilds the vertices from @p lines.
+     */
+    void
+        build(const std::vector<std::string>& lines);
+
+    /**
+     * @brief Appends an axis-aligned rectangle as two triangles.
+     */
+    void
+        appendQuad(float left, float top, float width, float height, const sf::Color& color);
+
+    std::vector<sf::Vertex> m_vertices;  ///< Triangulos del panel.
+    float m_scale = 2.f;                 ///< Pixeles de ventana por pixel de fuente.
+    bool m_hasRefreshed = false;         ///< Si m_lastRefresh es valido.
+    std::chrono::steady_clock::time_point m_lastRefresh; ///< Ultima reconstruccion.
+};
@@ -0,0 +1,106 @@
+#pragma once
+#include "../Prerequisites.h"
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @file Tessellation.h
+ * @brief Declares the polygon triangulator and the cache that shares its index buffers.
+ */
+
+/**
+ * @struct PolygonMesh
+ * @brief A polygon outline and the triangles that cover it.
+ *
+ * Every three entries of @p indices name the outline points of one triangle. Meshes are
+ * immutable once built, so one mesh is shared by every shape with the same outline.
+ */
+struct
+    PolygonMesh {
+    std::vector<sf::Vector2f> points; ///< Contorno en espacio local.
+    std::vector<uint32_t> indices;    ///< Tres indices por triangulo.
+    uint64_t hash = 0;                ///< Hash del contorno.
+};
+
+/**
+ * @struct TessellationStats
+ * @brief Counters of a TessellationCache.
+ */
+struct
+    TessellationStats {
+    uint64_t hits = 0;       ///< Lookups served by an existing mesh.
+    uint64_t misses = 0;     ///< Lookups that had to triangulate.
+    uint64_t failures = 0;   ///< Outlines that were not simple and fell back to a fan.
+    std::size_t meshes = 0;  ///< Meshes currently stored.
+};
+
+namespace Tessellation {
+
+    /**
+     * @brief Triangulates a simple polygon by ear clipping.
+     *
+     * The outline may be concave and wound either way. Collinear and repeated points are
+     * dropped without emitting a triangle. Runs in O(n^2) and only tests reflex vertices
+     * against each candidate ear.
+     *
+     * @param points Outline of the polygon, not closed (the last point is not the first).
+     * @param indices Receives three indices per triangle. Cleared first.
+     * @return false if the outline self-intersects or has fewer than three distinct points.
+     * @p indices then holds the triangles clipped before the failure.
+     */
+    bool
+        triangulate(const std::vector<sf::Vector2f>& points, std::vector<uint32_t>& indices);
+
+    /**
+     * @brief FNV-1a hash over the bit patterns of the outline coordinates.
+     */
+    uint64_t
+        hashPoints(const std::vector<sf::Vector2f>& points);
+}
+
+/**
+ * @class TessellationCache
+ * @brief Triangulates every distinct polygon outline once and shares the result.
+ *
+ * Meshes are keyed by the content hash of their outline; a lookup compares the stored
+ * points as well, so a hash collision never returns the wrong mesh. A mesh stays cached
+ * while the cache lives, which is what lets shapes created later reuse it.
+ *
+ * Lookups are guarded by a mutex; they happen when shapes are created, not per frame.
+ */
+class
+    TessellationCache {
+public:
+    TessellationCache() = default;
+    ~TessellationCache() = default;
+
+    /**
+     * @brief Cache used by CShape.
+     */
+    static TessellationCache&
+        getShared();
+
+    /**
+     * @brief Returns the mesh of an outline, triangulating it on the first request.
+     *
+     * If the outline is not simple, the mesh falls back to a triangle fan so it still draws.
+     *
+     * @param points Outline of the polygon, at least three points.
+     */
+    EngineUtilities::TSharedPointer<PolygonMesh>
+        acquire(const std::vector<sf::Vector2f>& points);
+
+    /**
+     * @brief Drops every mesh. Shapes keep the meshes they already hold.
+     */
+    void
+        clear();
+
+    TessellationStats
+        getStats() const;
+
+private:
+    mutable std::mutex m_mutex;  ///< Protege el mapa y los contadores.
+    std::unordered_map<uint64_t, std::vector<EngineUtilities::TSharedPointer<PolygonMesh>>> m_meshes; ///< Mallas por hash.
+    TessellationStats m_stats;   ///< Contadores.
+};
@@ -0,0 +1,157 @@
+#pragma once
+#include "../Prerequisites.h"
+
+/**
+ * @file TextureAtlas.h
+ * @brief Declares the skyline rectangle packer and the TextureAtlas that packs many small images into a few large textures.
+ */
+
+ /**
+  * @class SkylinePacker
+  * @brief Packs rectangles into a fixed-size bin with the skyline bottom-left heuristic.
+  */
+class
+    SkylinePacker {
+public:
+    /**
+     * @brief Creates an empty bin.
+     *
+     * @param width Width of the bin in pixels.
+     * @param height Height of the bin in pixels.
+     */
+    SkylinePacker(int width, int height);
+
+    /**
+     * @brief Finds room for a rectangle and marks it as used.
+     *
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param outRect Receives the placed rectangle.
+     * @return false if the rectangle does not fit in the bin.
+     */
+    bool
+        insert(int width, int height, sf::IntRect& outRect);
+
+    /**
+     * @brief Fraction of the bin area covered by inserted rectangles.
+     */
+    float
+        getOccupancy() const;
+
+private:
+    /**
+     * @struct Node
+     * @brief Horizontal segment of the skyline.
+     */
+    struct
+        Node {
+        int x;     ///< Left edge of the segment.
+        int y;     ///< Height of the skyline along the segment.
+        int width; ///< Width of the segment.
+    };
+
+    /**
+     * @brief Returns the y at which a rectangle fits when its left edge is at node @p index,
+     * or -1 if it does not fit there.
+     */
+    int
+        fitAt(std::size_t index, int width, int height) const;
+
+    int m_width;              ///< Width of the bin.
+    int m_height;             ///< Height of the bin.
+    long long m_usedArea = 0; ///< Area covered by inserted rectangles.
+    std::vector<Node> m_skyline; ///< Skyline segments from left to right.
+};
+
+/**
+ * @struct AtlasRegion
+ * @brief Location of a packed image inside the atlas.
+ */
+struct
+    AtlasRegion {
+    const sf::Texture* texture = nullptr; ///< Page texture holding the image.
+    sf::IntRect rect;                     ///< Pixel rectangle of the image in the page, used as texture coordinates.
+    uint32_t page = 0;                    ///< Index of the page.
+};
+
+/**
+ * @class TextureAtlas
+ * @brief Packs many small images into a few large page textures.
+ *
+ * Images are added by name, then build() packs them tallest first, copies them into page
+ * images and uploads one texture per page. Every sprite that uses the same page shares a
+ * texture, so the RenderQueue merges them into a single batch.
+ *
+ * build() may be called again after more images are added: the new images go to new
+ * pages and the regions of earlier builds keep their pages.
+ */
+class
+    TextureAtlas {
+public:
+    static const uint32_t kInvalidRegion = 0xFFFFFFFFu; ///< Returned when an image cannot be added.
+
+    /**
+     * @brief Creates an empty atlas.
+     *
+     * @param pageSize Width and height of each page in pixels.
+     * @param padding Empty pixels kept around every image to avoid bleeding when filtering.
+     */
+    explicit TextureAtlas(int pageSize = 2048, int padding = 1);
+
+    /**
+     * @brief Queues an image for packing.
+     *
+     * @param name Name used to look the region up.
+     * @param image Image to pack. It is copied.
+     * @return Region index, valid once build() has succeeded.
+     */
+    uint32_t
+        addImage(const std::string& name, const sf::Image& image);
+
+    /**
+     * @brief Loads an image from disk and queues it for packing.
+     *
+     * @param name Name used to look the region up.
+     * @param path Path of the image file.
+     * @return Region index, valid once build() has succeeded, or kInvalidRegion if the
+     * file could not be loaded.
+     */
+    uint32_t
+        addImageFromFile(const std::string& name, const std::string& path);
+
+    /**
+     * @brief Packs the images queued since the last build into new pages and uploads the
+     * page textures.
+     *
+     * @return false if an image is larger than a page or a texture could not be created.
+     */
+    bool
+        build();
+
+    /**
+     * @brief Returns a packed region by index.
+     */
+    const AtlasRegion&
+        getRegion(uint32_t index) const { return m_regions[index]; }
+
+    /**
+     * @brief Returns a packed region by name, or nullptr if the name is unknown.
+     */
+    const AtlasRegion*
+        findRegion(const std::string& name) const;
+
+    /**
+     * @brief Number of page textures created by build().
+     */
+    std::size_t
+        getPageCount() const { return m_pages.size(); }
+
+private:
+    int m_pageSize; ///< Width and height of each page.
+    int m_padding;  ///< Empty pixels around every image.
+
+    std::vector<sf::Image> m_images;        ///< Images waiting for build().
+    std::vector<AtlasRegion> m_regions;     ///< One region per added image.
+    std::unordered_map<std::string, uint32_t> m_names; ///< Region index by name.
+    std::vector<EngineUtilities::TSharedPointer<sf::Texture>> m_pages; ///< Page textures.
+};
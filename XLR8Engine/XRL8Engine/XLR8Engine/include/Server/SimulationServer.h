@@ -0,0 +1,115 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Core/ThreadPool.h"
+#include "World.h"
+#include <atomic>
+
+/**
+ * @file SimulationServer.h
+ * @brief Declares the SimulationServer, which runs many worlds headless on a thread pool.
+ */
+
+/**
+ * @brief Identifies a world of a SimulationServer. 0 is never a valid ID.
+ */
+typedef uint64_t WorldId;
+
+/**
+ * @class SimulationServer
+ * @brief Hosts independent simulation sessions in one process, without any Window.
+ *
+ * Every tick spreads the worlds over a ThreadPool, one world per task, and each world
+ * runs the fixed steps its own rate calls for. run() ticks in real time and sleeps until
+ * the next world is due, so worlds with different rates share the cores without busy
+ * waiting. Removing a world frees its arena in one go.
+ *
+ * Worlds must not touch each other or the server from their steps. addWorld(),
+ * removeWorld() and tick() are called from the thread that owns the server; stop() may
+ * be called from any thread.
+ */
+class
+    SimulationServer {
+public:
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param threadCount Worker threads, as in ThreadPool. 0 uses the hardware threads.
+     */
+    explicit SimulationServer(std::size_t threadCount = 0);
+
+    SimulationServer(const SimulationServer&) = delete;
+    SimulationServer& operator=(const SimulationServer&) = delete;
+
+    /**
+     * @brief Creates a world. It starts stepping on the next tick.
+     */
+    WorldId
+        addWorld(const WorldSettings& settings = WorldSettings());
+
+    /**
+     * @brief World of an ID, or nullptr for a removed world.
+     */
+    World*
+        getWorld(WorldId id);
+
+    /**
+     * @brief Destroys a world and releases its arena. Stale IDs are ignored.
+     */
+    void
+        removeWorld(WorldId id);
+
+    /**
+     * @brief Advances every world by @p seconds of real time, in parallel.
+     *
+     * @return Steps run, summed over the worlds.
+     */
+    uint64_t
+        tick(double seconds);
+
+    /**
+     * @brief Ticks in real time until stop() is called or @p duration seconds pass.
+     *
+     * @param duration Seconds to run; 0 or less runs until stop().
+     */
+    void
+        run(double duration = 0.0);
+
+    /**
+     * @brief Makes run() return after its current tick. Called before run(), it makes the
+     * next run() return after its first tick.
+     */
+    void
+        stop() { m_stopRequested.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of live worlds.
+     */
+    std::size_t
+        getWorldCount() const { return m_active.size(); }
+
+    /**
+     * @brief Steps run by every world since the server started, removed worlds included.
+     */
+    uint64_t
+        getStepCount() const { return m_stepCount; }
+
+private:
+    /**
+     * @struct Slot
+     * @brief A world owned by the server.
+     */
+    struct
+        Slot {
+        EngineUtilities::TUniquePtr<World> world; ///< Mundo; nulo si el slot esta libre.
+        uint32_t generation = 1;                  ///< Invalida IDs de un slot reciclado.
+        uint32_t activeIndex = 0;                 ///< Posicion en m_active.
+    };
+
+    ThreadPool m_pool;                         ///< Hilos que avanzan los mundos.
+    std::vector<Slot> m_slots;                 ///< Mundos por slot.
+    std::vector<uint32_t> m_freeSlots;         ///< Slots libres.
+    std::vector<uint32_t> m_active;            ///< Slots con mundo, densos para el tick.
+    std::vector<uint32_t> m_tickSteps;         ///< Pasos de cada mundo en el tick.
+    uint64_t m_stepCount = 0;                  ///< Pasos totales.
+    std::atomic<bool> m_stopRequested{ false }; ///< Pedido por stop().
+};
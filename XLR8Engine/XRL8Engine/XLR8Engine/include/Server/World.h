@@ -0,0 +1,130 @@
+#pragma once
+#include "../Prerequisites.h"
+#include "../Core/BehaviourScheduler.h"
+#include "../ECS/TweenSystem.h"
+#include "../Memory/MemoryArena.h"
+#include <functional>
+
+/**
+ * @file World.h
+ * @brief Declares the World, one independent simulation session without a window.
+ */
+
+/**
+ * @struct WorldSettings
+ * @brief Configuration of a World.
+ */
+struct
+    WorldSettings {
+    std::string name = "World";            ///< Nombre para los logs.
+    float stepRate = 60.f;                 ///< Pasos fijos por segundo.
+    uint32_t maxStepsPerAdvance = 8;       ///< Tope de pasos por advance(); el resto se descarta.
+    std::size_t arenaBlockSize = 64 * 1024; ///< Bytes de cada bloque de la arena.
+};
+
+/**
+ * @class World
+ * @brief A simulation session stepped at its own fixed rate.
+ *
+ * advance() feeds real time into an accumulator and runs as many fixed steps as fit.
+ * Each step calls the step callback, then resumes the world's behaviours and advances
+ * its tweens, in the same order BaseApp::update() uses. A world that falls behind runs
+ * at most WorldSettings::maxStepsPerAdvance steps and drops the remaining time, so one
+ * slow session cannot snowball.
+ *
+ * Session state should be allocated from getArena(). Destroying the world releases the
+ * arena block by block: state made of trivially destructible objects is freed without
+ * visiting a single object.
+ *
+ * A world is stepped by one thread at a time; different worlds may run concurrently.
+ */
+class
+    World {
+public:
+    /**
+     * @brief Callback run once per fixed step with the step length in seconds.
+     */
+    typedef std::function<void(World&, float)> StepCallback;
+
+    explicit World(const WorldSettings& settings = WorldSettings());
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    /**
+     * @brief Sets the simulation run by every step.
+     */
+    void
+        setStepCallback(StepCallback callback) { m_stepCallback = std::move(callback); }
+
+    /**
+     * @brief Runs the fixed steps that fit in the accumulated time.
+     *
+     * @param seconds Real time elapsed since the previous call.
+     * @return Steps run.
+     */
+    uint32_t
+        advance(double seconds);
+
+    /**
+     * @brief Seconds until the accumulator holds a whole step.
+     */
+    double
+        getTimeToNextStep() const { return m_stepLength - m_accumulator; }
+
+    /**
+     * @brief Memory of the session, released all at once with the world.
+     */
+    EngineUtilities::MemoryArena&
+        getArena() { return m_arena; }
+
+    /**
+     * @brief Coroutine behaviours of the world, resumed every step.
+     */
+    BehaviourScheduler&
+        getBehaviours() { return m_behaviours; }
+
+    /**
+     * @brief Tweens of the world, advanced every step after the behaviours.
+     */
+    TweenSystem&
+        getTweens() { return m_tweens; }
+
+    const WorldSettings&
+        getSettings() const { return m_settings; }
+
+    /**
+     * @brief Length of a step in seconds.
+     */
+    float
+        getStepLength() const { return static_cast<float>(m_stepLength); }
+
+    /**
+     * @brief Steps run since the world was created.
+     */
+    uint64_t
+        getStepCount() const { return m_stepCount; }
+
+    /**
+     * @brief Steps dropped because the world fell behind.
+     */
+    uint64_t
+        getDroppedSteps() const { return m_droppedSteps; }
+
+    /**
+     * @brief Simulated seconds, the step count times the step length.
+     */
+    double
+        getTime() const { return static_cast<double>(m_stepCount) * m_stepLength; }
+
+private:
+    WorldSettings m_settings;                 ///< Configuracion del mundo.
+    double m_stepLength;                      ///< Segundos por paso.
+    double m_accumulator = 0.0;               ///< Tiempo real sin simular.
+    uint64_t m_stepCount = 0;                 ///< Pasos ejecutados.
+    uint64_t m_droppedSteps = 0;              ///< Pasos descartados por retraso.
+    StepCallback m_stepCallback;              ///< Simulacion de cada paso.
+    EngineUtilities::MemoryArena m_arena;     ///< Estado de la sesion; sobrevive a behaviours y tweens.
+    BehaviourScheduler m_behaviours;          ///< Comportamientos del mundo.
+    TweenSystem m_tweens;                     ///< Tweens del mundo.
+};
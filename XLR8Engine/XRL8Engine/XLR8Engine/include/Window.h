@@ -2,16 +2,22 @@
 #include "Prerequisites.h"
 #include "Memory/TSharedPointer.h"
 #include "Memory/TUniquePtr.h"
+#include "Render/RenderBackend.h"
+#include "Render/RenderQueue.h"
+#include "Input/InputSystem.h"
+#include "Core/Telemetry.h"
+#include "Render/StatsOverlay.h"
 
 
 /**
  * @file Window.h
- * @brief Declares the Window class, a wrapper for managing an SFML RenderWindow.
+ * @brief Declares the Window class, a wrapper for managing a render backend.
  */
 
  /**
   * @class Window
-  * @brief Encapsulates an SFML window, handling initialization, events, rendering, and cleanup.
+  * @brief Encapsulates a render backend (an SFML window or a headless recorder), handling
+  * initialization, events, rendering, and cleanup.
   */
 class
     Window {
@@ -32,6 +38,15 @@ public:
      */
     Window(int width, int height, const std::string& title);
 
+    /**
+     * @brief Constructs a window on top of an existing render backend.
+     *
+     * Use a NullRenderBackend to run without a display.
+     *
+     * @param backend Backend to take ownership of.
+     */
+    explicit Window(RenderBackend* backend);
+
     /**
      * @brief Destructor. Releases any allocated resources.
      */
@@ -40,7 +55,8 @@ public:
     /**
      * @brief Handles window events (e.g., close, input).
      *
-     * Processes all SFML events in the queue.
+     * Processes all SFML events in the queue and feeds them to the InputSystem, which
+     * publishes the input snapshot of the frame. F3 toggles the stats overlay.
      */
     void
         handleEvents();
@@ -71,9 +87,25 @@ public:
         draw(const sf::Drawable& drawable,
             const sf::RenderStates& states = sf::RenderStates::Default);
 
+    /**
+     * @brief Draws a raw range of vertices to the window.
+     *
+     * @param vertices Pointer to the first vertex.
+     * @param vertexCount Number of vertices to draw.
+     * @param type Primitive type of the range.
+     * @param states Optional render states. Defaults to sf::RenderStates::Default.
+     */
+    void
+        draw(const sf::Vertex* vertices,
+            std::size_t vertexCount,
+            sf::PrimitiveType type,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+
     /**
      * @brief Displays the contents of the window.
      *
+     * Flushes the render queue, draws the stats overlay if it is shown, presents the
+     * frame and commits the frame to the telemetry.
      * Should be called after drawing all objects for the current frame.
      */
     void
@@ -82,12 +114,57 @@ public:
     /**
      * @brief Releases the window resources.
      *
-     * Properly deletes the internal SFML window pointer.
+     * Properly deletes the internal render backend.
      */
     void
         destroy();
 
+    /**
+     * @brief Render counters of the last presented frame.
+     */
+    const RenderStats&
+        getFrameStats() const;
+
+    /**
+     * @brief Render counters accumulated since the window was created.
+     */
+    const RenderStats&
+        getTotalStats() const;
+
+    /**
+     * @brief Queue of sorted draw items flushed by display().
+     */
+    RenderQueue&
+        getRenderQueue() { return m_renderQueue; }
+
+    /**
+     * @brief Input system fed by handleEvents(). Use it to bind actions and read the snapshot.
+     */
+    InputSystem&
+        getInput() { return m_input; }
+
+    /**
+     * @brief Per-frame counters committed by display(). Register game counters here.
+     */
+    Telemetry&
+        getTelemetry() { return m_telemetry; }
+
+    /**
+     * @brief Shows or hides the stats overlay. While hidden, and with no telemetry
+     * stream open, the counters are not sampled.
+     */
+    void
+        setOverlayEnabled(bool enabled);
+
+    bool
+        isOverlayEnabled() const { return m_overlayEnabled; }
+
 private:
-    EngineUtilities::TUniquePtr<sf::RenderWindow> m_windowPtr; ///< Unique pointer to the SFML render window.
+    EngineUtilities::TUniquePtr<RenderBackend> m_backendPtr; ///< Unique pointer to the render backend.
+    RenderQueue m_renderQueue; ///< Draw items of the current frame.
+    InputSystem m_input; ///< Buffered input of the current frame.
     sf::View m_view; ///< View used for rendering (not currently exposed).
+    Telemetry m_telemetry; ///< Counters of the frame.
+    StatsOverlay m_overlay; ///< Panel that shows m_telemetry.
+    bool m_overlayEnabled = false; ///< Whether display() draws m_overlay.
 };
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include "Assets/AssetArchive.h"
+#include "Assets/AssetCompression.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define NOGDI
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file AssetArchive.cpp
+ * @brief Archive writer and memory-mapped reader. The format is written and read in host
+ * byte order, which is little-endian on every platform the engine targets.
+ */
+
+using AssetArchiveFormat::ArchiveEntry;
+using AssetArchiveFormat::ArchiveHeader;
+
+namespace {
+    uint64_t
+        alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    void
+        writePadding(std::ofstream& file, uint64_t& position, uint64_t target) {
+        static const char zeros[64] = {};
+        while (position < target) {
+            const uint64_t count = std::min<uint64_t>(target - position, sizeof(zeros));
+            file.write(zeros, static_cast<std::streamsize>(count));
+            position += count;
+        }
+    }
+
+    /**
+     * @brief Whether [offset, offset + size) lies inside a buffer of @p total bytes.
+     */
+    bool
+        inRange(uint64_t offset, uint64_t size, uint64_t total) {
+        return offset <= total && size <= total - offset;
+    }
+}
+
+namespace AssetArchiveFormat {
+
+    std::string
+        normalizeName(const std::string& path) {
+        std::string name = path;
+        std::replace(name.begin(), name.end(), '\\', '/');
+        while (name.compare(0, 2, "./") == 0) {
+            name.erase(0, 2);
+        }
+        return name;
+    }
+
+    uint64_t
+        hashName(const std::string& name) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
+
+bool
+AssetArchiveWriter::addFile(const std::string& name, const std::string& path, bool compress) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        ERROR("AssetArchiveWriter", "addFile", path);
+        return false;
+    }
+
+    std::vector<uint8_t> bytes(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!bytes.empty() && !file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+        ERROR("AssetArchiveWriter", "addFile", path);
+        return false;
+    }
+    addData(name, std::move(bytes), compress);
+    return true;
+}
+
+void
+AssetArchiveWriter::addData(const std::string& name, std::vector<uint8_t> bytes, bool compress) {
+    PendingEntry entry;
+    entry.name = AssetArchiveFormat::normalizeName(name);
+    entry.size = bytes.size();
+    entry.compressed = false;
+
+    if (compress && !bytes.empty()) {
+        std::vector<uint8_t> packed;
+        AssetCompression::compress(bytes.data(), bytes.size(), packed);
+        if (packed.size() <= bytes.size() - bytes.size() / 8) {
+            bytes.swap(packed);
+            entry.compressed = true;
+        }
+    }
+    entry.bytes = std::move(bytes);
+
+    for (PendingEntry& existing : m_entries) {
+        if (existing.name == entry.name) {
+            existing = std::move(entry);
+            return;
+        }
+    }
+    m_entries.push_back(std::move(entry));
+}
+
+/**
+ * @brief Writes the header, the aligned entry data, the sorted table and the names.
+ */
+bool
+AssetArchiveWriter::write(const std::string& path, uint32_t alignment) const {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        ERROR("AssetArchiveWriter", "write", "alignment must be a power of two");
+        return false;
+    }
+
+    std::vector<const PendingEntry*> order;
+    order.reserve(m_entries.size());
+    for (const PendingEntry& entry : m_entries) {
+        order.push_back(&entry);
+    }
+    std::vector<uint64_t> hashes(m_entries.size());
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+        hashes[i] = AssetArchiveFormat::hashName(m_entries[i].name);
+    }
+    std::sort(order.begin(), order.end(), [&](const PendingEntry* a, const PendingEntry* b) {
+        const uint64_t hashA = hashes[a - m_entries.data()];
+        const uint64_t hashB = hashes[b - m_entries.data()];
+        return hashA != hashB ? hashA < hashB : a->name < b->name;
+        });
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        ERROR("AssetArchiveWriter", "write", path);
+        return false;
+    }
+
+    ArchiveHeader header = {};
+    std::memcpy(header.magic, AssetArchiveFormat::kMagic, sizeof(header.magic));
+    header.version = AssetArchiveFormat::kVersion;
+    header.entryCount = static_cast<uint32_t>(order.size());
+    header.alignment = alignment;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t position = sizeof(header);
+
+    std::vector<ArchiveEntry> table(order.size());
+    std::string names;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const PendingEntry& pending = *order[i];
+        writePadding(file, position, alignUp(position, alignment));
+
+        ArchiveEntry& entry = table[i];
+        entry.hash = hashes[order[i] - m_entries.data()];
+        entry.offset = position;
+        entry.storedSize = pending.bytes.size();
+        entry.size = pending.size;
+        entry.nameOffset = static_cast<uint32_t>(names.size());
+        entry.nameLength = static_cast<uint32_t>(pending.name.size());
+        entry.flags = pending.compressed ? AssetArchiveFormat::kEntryCompressed : 0;
+        entry.reserved = 0;
+
+        file.write(reinterpret_cast<const char*>(pending.bytes.data()), static_cast<std::streamsize>(pending.bytes.size()));
+        position += pending.bytes.size();
+        names += pending.name;
+    }
+
+    // La tabla se lee en el mapeo como ArchiveEntry, asi que va alineada a 8
+    writePadding(file, position, alignUp(position, 8));
+    header.tocOffset = position;
+    file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(ArchiveEntry)));
+    position += table.size() * sizeof(ArchiveEntry);
+    header.namesOffset = position;
+    header.namesSize = names.size();
+    file.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!file) {
+        ERROR("AssetArchiveWriter", "write", path);
+        return false;
+    }
+    return true;
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+/**
+ * @brief Maps the file read-only and validates every entry, so lookups and view() need
+ * no further checks. A compressed entry cannot claim more than 256 times its stored size,
+ * the most the codec can expand, so a corrupt size never drives a huge allocation.
+ */
+bool
+AssetArchive::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        ERROR("AssetArchive", "open", path);
+        return false;
+    }
+    m_fileHandle = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        ERROR("AssetArchive", "open", path);
+        close();
+        return false;
+    }
+    m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mappingHandle == nullptr) {
+        ERROR("AssetArchive", "open", path);
+        close();
+        return false;
+    }
+    m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        ERROR("AssetArchive", "open", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0) {
+        ::close(file);
+        ERROR("AssetArchive", "open", path);
+        return false;
+    }
+    void* mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping != MAP_FAILED) {
+        m_data = static_cast<const uint8_t*>(mapping);
+        m_size = static_cast<std::size_t>(info.st_size);
+    }
+#endif
+    if (m_data == nullptr) {
+        ERROR("AssetArchive", "open", path);
+        close();
+        return false;
+    }
+    m_path = path;
+
+    ArchiveHeader header;
+    bool valid = m_size >= sizeof(header);
+    if (valid) {
+        std::memcpy(&header, m_data, sizeof(header));
+        valid = std::memcmp(header.magic, AssetArchiveFormat::kMagic, sizeof(header.magic)) == 0 &&
+            header.version == AssetArchiveFormat::kVersion &&
+            header.alignment != 0 && (header.alignment & (header.alignment - 1)) == 0 &&
+            header.tocOffset % alignof(ArchiveEntry) == 0 &&
+            inRange(header.tocOffset, uint64_t(header.entryCount) * sizeof(ArchiveEntry), m_size) &&
+            inRange(header.namesOffset, header.namesSize, m_size);
+    }
+    if (valid) {
+        m_entries = reinterpret_cast<const ArchiveEntry*>(m_data + header.tocOffset);
+        m_names = reinterpret_cast<const char*>(m_data + header.namesOffset);
+        m_entryCount = header.entryCount;
+        for (uint32_t i = 0; i < m_entryCount && valid; ++i) {
+            const ArchiveEntry& entry = m_entries[i];
+            const bool compressed = (entry.flags & AssetArchiveFormat::kEntryCompressed) != 0;
+            valid = inRange(entry.offset, entry.storedSize, m_size) &&
+                inRange(entry.nameOffset, entry.nameLength, header.namesSize) &&
+                (compressed ? entry.size / 256 <= entry.storedSize : entry.storedSize == entry.size) &&
+                (i == 0 || m_entries[i - 1].hash <= entry.hash);
+        }
+    }
+    if (!valid) {
+        ERROR("AssetArchive", "open", "not a valid archive: " + path);
+        close();
+        return false;
+    }
+    return true;
+}
+
+void
+AssetArchive::close() {
+#ifdef _WIN32
+    if (m_data != nullptr) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle != nullptr) {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle != nullptr) {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data != nullptr) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_path.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_entries = nullptr;
+    m_names = nullptr;
+    m_entryCount = 0;
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+}
+
+/**
+ * @brief Binary search over the hashes, then a name comparison for each collision.
+ */
+uint32_t
+AssetArchive::find(const std::string& name) const {
+    if (m_entryCount == 0) {
+        return kNotFound;
+    }
+
+    const std::string normalized = AssetArchiveFormat::normalizeName(name);
+    const uint64_t hash = AssetArchiveFormat::hashName(normalized);
+    const ArchiveEntry* end = m_entries + m_entryCount;
+    const ArchiveEntry* entry = std::lower_bound(m_entries, end, hash,
+        [](const ArchiveEntry& a, uint64_t value) { return a.hash < value; });
+
+    for (; entry != end && entry->hash == hash; ++entry) {
+        if (entry->nameLength == normalized.size() &&
+            std::memcmp(m_names + entry->nameOffset, normalized.data(), normalized.size()) == 0) {
+            return static_cast<uint32_t>(entry - m_entries);
+        }
+    }
+    return kNotFound;
+}
+
+std::string
+AssetArchive::getName(uint32_t index) const {
+    const ArchiveEntry& entry = m_entries[index];
+    return std::string(m_names + entry.nameOffset, entry.nameLength);
+}
+
+const uint8_t*
+AssetArchive::view(uint32_t index, std::vector<uint8_t>& scratch) const {
+    const ArchiveEntry& entry = m_entries[index];
+    const uint8_t* stored = m_data + entry.offset;
+    if ((entry.flags & AssetArchiveFormat::kEntryCompressed) == 0) {
+        return stored;
+    }
+
+    scratch.resize(static_cast<std::size_t>(entry.size));
+    if (!AssetCompression::decompress(stored, static_cast<std::size_t>(entry.storedSize),
+        scratch.data(), scratch.size())) {
+        ERROR("AssetArchive", "view", "corrupt entry " + getName(index));
+        return nullptr;
+    }
+    return scratch.data();
+}
@@ -0,0 +1,202 @@
+#include "Assets/AssetCompression.h"
+#include <cstring>
+
+/**
+ * @file AssetCompression.cpp
+ * @brief Greedy hash-table LZ encoder and bounds-checked decoder.
+ */
+
+namespace {
+    const std::size_t kMinMatch = 4;           ///< Shortest match worth a sequence.
+    const std::size_t kLastLiterals = 5;       ///< The stream always ends with this many literals.
+    const std::size_t kMatchSafety = 12;       ///< No match starts closer than this to the end.
+    const std::size_t kMaxOffset = 65535;      ///< Farthest back a match can point.
+    const unsigned kHashBits = 14;             ///< Size of the match finder table.
+    const std::size_t kWildCopy = 16;          ///< Literal runs up to this size are copied as one block.
+
+    uint32_t
+        read32(const uint8_t* data) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    uint32_t
+        hash4(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - kHashBits);
+    }
+
+    /**
+     * @brief Writes the extra bytes of a length that did not fit in its nibble.
+     */
+    void
+        writeLength(std::vector<uint8_t>& output, std::size_t length) {
+        while (length >= 255) {
+            output.push_back(255);
+            length -= 255;
+        }
+        output.push_back(static_cast<uint8_t>(length));
+    }
+
+    /**
+     * @brief Emits one sequence. A @p matchLength of zero ends the stream.
+     */
+    void
+        writeSequence(std::vector<uint8_t>& output, const uint8_t* literals, std::size_t literalCount,
+            std::size_t offset, std::size_t matchLength) {
+        const std::size_t matchCode = matchLength != 0 ? matchLength - kMinMatch : 0;
+        const uint8_t token = static_cast<uint8_t>(
+            ((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+        output.push_back(token);
+        if (literalCount >= 15) {
+            writeLength(output, literalCount - 15);
+        }
+        output.insert(output.end(), literals, literals + literalCount);
+        if (matchLength == 0) {
+            return;
+        }
+
+        output.push_back(static_cast<uint8_t>(offset & 0xFF));
+        output.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15) {
+            writeLength(output, matchCode - 15);
+        }
+    }
+
+    /**
+     * @brief Reads the extra bytes of a length whose nibble was 15.
+     */
+    bool
+        readLength(const uint8_t*& in, const uint8_t* end, std::size_t& length) {
+        uint8_t value;
+        do {
+            if (in == end) {
+                return false;
+            }
+            value = *in++;
+            length += value;
+        } while (value == 255);
+        return true;
+    }
+}
+
+namespace AssetCompression {
+
+    std::size_t
+        compressBound(std::size_t size) {
+        return size + size / 255 + 16;
+    }
+
+    void
+        compress(const uint8_t* source, std::size_t size, std::vector<uint8_t>& output) {
+        output.clear();
+        output.reserve(compressBound(size));
+
+        std::size_t anchor = 0;
+        if (size > kMatchSafety) {
+            // Posicion + 1 de la ultima aparicion de cada hash; 0 es vacio
+            std::vector<uint32_t> table(std::size_t(1) << kHashBits, 0);
+            const std::size_t matchLimit = size - kMatchSafety;
+            const std::size_t extendLimit = size - kLastLiterals;
+
+            std::size_t position = 0;
+            while (position < matchLimit) {
+                const uint32_t sequence = read32(source + position);
+                uint32_t& bucket = table[hash4(sequence)];
+                const std::size_t candidate = bucket;
+                bucket = static_cast<uint32_t>(position + 1);
+
+                if (candidate == 0 || position - (candidate - 1) > kMaxOffset ||
+                    read32(source + candidate - 1) != sequence) {
+                    // Salta mas rapido por datos que no comprimen
+                    position += 1 + ((position - anchor) >> 6);
+                    continue;
+                }
+
+                const std::size_t reference = candidate - 1;
+                std::size_t length = kMinMatch;
+                while (position + length < extendLimit && source[reference + length] == source[position + length]) {
+                    ++length;
+                }
+
+                writeSequence(output, source + anchor, position - anchor, position - reference, length);
+                position += length;
+                anchor = position;
+            }
+        }
+        writeSequence(output, source + anchor, size - anchor, 0, 0);
+    }
+
+    bool
+        decompress(const uint8_t* source, std::size_t sourceSize,
+            uint8_t* destination, std::size_t destinationSize) {
+        const uint8_t* in = source;
+        const uint8_t* const inEnd = source + sourceSize;
+        std::size_t written = 0;
+
+        while (in < inEnd) {
+            const uint8_t token = *in++;
+
+            std::size_t literalCount = token >> 4;
+            if (literalCount == 15 && !readLength(in, inEnd, literalCount)) {
+                return false;
+            }
+            if (literalCount > static_cast<std::size_t>(inEnd - in) || literalCount > destinationSize - written) {
+                return false;
+            }
+            if (literalCount <= kWildCopy && static_cast<std::size_t>(inEnd - in) >= kWildCopy &&
+                destinationSize - written >= kWildCopy) {
+                // Copia fija de 16 bytes; el sobrante se sobrescribe despues
+                std::memcpy(destination + written, in, kWildCopy);
+            }
+            else if (literalCount != 0) {
+                std::memcpy(destination + written, in, literalCount);
+            }
+            in += literalCount;
+            written += literalCount;
+
+            if (in == inEnd) {
+                break;
+            }
+
+            if (inEnd - in < 2) {
+                return false;
+            }
+            const std::size_t offset = static_cast<std::size_t>(in[0]) | (static_cast<std::size_t>(in[1]) << 8);
+            in += 2;
+            if (offset == 0 || offset > written) {
+                return false;
+            }
+
+            std::size_t length = token & 15;
+            if (length == 15 && !readLength(in, inEnd, length)) {
+                return false;
+            }
+            length += kMinMatch;
+            if (length > destinationSize - written) {
+                return false;
+            }
+
+            const uint8_t* match = destination + written - offset;
+            uint8_t* out = destination + written;
+            if (offset >= 8 && destinationSize - written >= length + 8) {
+                // Bloques de 8 bytes: con offset >= 8 cada bloque lee bytes ya escritos,
+                // y el ultimo puede pasarse porque queda espacio en el destino
+                for (std::size_t i = 0; i < length; i += 8) {
+                    std::memcpy(out + i, match + i, 8);
+                }
+            }
+            else if (offset >= length) {
+                std::memcpy(out, match, length);
+            }
+            else {
+                // Periodo corto que se solapa con lo que escribe
+                for (std::size_t i = 0; i < length; ++i) {
+                    out[i] = match[i];
+                }
+            }
+            written += length;
+        }
+        return written == destinationSize;
+    }
+}
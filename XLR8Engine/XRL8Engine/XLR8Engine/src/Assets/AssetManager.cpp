@@ -0,0 +1,431 @@
+#include "Assets/AssetManager.h"
+#include <algorithm>
+
+/**
+ * @file AssetManager.cpp
+ * @brief Implementation of the asynchronous asset loader and its LRU cache.
+ */
+
+namespace {
+    /**
+     * @brief Reads a whole file into memory.
+     */
+    bool
+        readFile(const std::string& path, AssetBytes& bytes) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return false;
+        }
+        const std::streamoff size = file.tellg();
+        if (size < 0) {
+            return false;
+        }
+        bytes.resize(static_cast<std::size_t>(size));
+        file.seekg(0);
+        return size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), size));
+    }
+
+    /**
+     * @brief Deduplication key: the same file loaded as two types is two assets.
+     */
+    std::string
+        makeKey(const std::string& path, AssetType type) {
+        std::string key(1, static_cast<char>('0' + type));
+        key += path;
+        return key;
+    }
+
+    std::size_t
+        imageBytes(const sf::Vector2u& size) {
+        return static_cast<std::size_t>(size.x) * size.y * 4;
+    }
+}
+
+AssetManager::AssetManager(std::size_t memoryBudget, std::size_t workerCount)
+    : m_memoryBudget(memoryBudget), m_workers(std::max<std::size_t>(1, workerCount)) {
+}
+
+/**
+ * @brief Tells the workers to skip the queued files, then joins them before the slots go.
+ */
+AssetManager::~AssetManager() {
+    m_shuttingDown.store(true, std::memory_order_relaxed);
+    m_workers.waitIdle();
+}
+
+bool
+AssetManager::mountArchive(const std::string& path) {
+    EngineUtilities::TUniquePtr<AssetArchive> archive = EngineUtilities::MakeUnique<AssetArchive>();
+    if (!archive->open(path)) {
+        return false;
+    }
+    m_archives.push_back(std::move(archive));
+    return true;
+}
+
+AssetHandle<sf::Texture>
+AssetManager::loadTexture(const std::string& path) {
+    return AssetHandle<sf::Texture>(this, request(path, ASSET_TEXTURE));
+}
+
+AssetHandle<sf::Image>
+AssetManager::loadImage(const std::string& path) {
+    return AssetHandle<sf::Image>(this, request(path, ASSET_IMAGE));
+}
+
+AssetHandle<sf::Font>
+AssetManager::loadFont(const std::string& path) {
+    return AssetHandle<sf::Font>(this, request(path, ASSET_FONT));
+}
+
+AssetHandle<AssetBytes>
+AssetManager::loadBinary(const std::string& path) {
+    return AssetHandle<AssetBytes>(this, request(path, ASSET_BINARY));
+}
+
+/**
+ * @brief Finds the asset of a path or creates its slot and queues the decode.
+ */
+uint32_t
+AssetManager::request(const std::string& path, AssetType type) {
+    m_stats.requests++;
+
+    const std::string key = makeKey(path, type);
+    auto it = m_slotByPath.find(key);
+    if (it != m_slotByPath.end()) {
+        m_stats.deduplicated++;
+        return it->second;
+    }
+
+    uint32_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.path = path;
+    slot.type = type;
+    slot.state = ASSET_LOADING;
+    slot.refs = 0;
+    slot.bytes = 0;
+    slot.inUse = true;
+    m_slotByPath.emplace(key, index);
+    m_stats.loads++;
+    m_stats.pending++;
+
+    // El ultimo archivo montado tiene prioridad
+    const AssetArchive* archive = nullptr;
+    uint32_t entry = AssetArchive::kNotFound;
+    for (auto it = m_archives.rbegin(); it != m_archives.rend() && archive == nullptr; ++it) {
+        entry = (*it)->find(path);
+        if (entry != AssetArchive::kNotFound) {
+            archive = it->get();
+            m_stats.archiveLoads++;
+        }
+    }
+
+    const uint32_t generation = slot.generation;
+    m_workers.enqueue([this, path, archive, entry, type, index, generation]() {
+        Decoded decoded{ index, generation, EngineUtilities::TUniquePtr<AssetDetail::AssetData>() };
+        if (!m_shuttingDown.load(std::memory_order_relaxed)) {
+            decoded.data = decode(path, archive, entry, type);
+        }
+
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        m_completed.push_back(std::move(decoded));
+        m_completedCount.store(m_completed.size(), std::memory_order_release);
+        m_completedSignal.notify_all();
+        });
+    return index;
+}
+
+/**
+ * @brief Reads the file and does every CPU-side step of the decode.
+ *
+ * Textures stop at the decoded image: the upload needs the render thread's context and
+ * happens in update(). An uncompressed archive entry is decoded in place from the
+ * mapping; only binary assets copy it, since their handle returns AssetBytes.
+ */
+EngineUtilities::TUniquePtr<AssetDetail::AssetData>
+AssetManager::decode(const std::string& path, const AssetArchive* archive, uint32_t entry, AssetType type) {
+    EngineUtilities::TUniquePtr<AssetDetail::AssetData> data(new AssetDetail::AssetData());
+    const uint8_t* contents;
+    std::size_t size;
+    if (archive != nullptr) {
+        contents = archive->view(entry, data->bytes);
+        size = archive->getSize(entry);
+        if (contents == nullptr) {
+            return EngineUtilities::TUniquePtr<AssetDetail::AssetData>();
+        }
+    }
+    else {
+        if (!readFile(path, data->bytes)) {
+            return EngineUtilities::TUniquePtr<AssetDetail::AssetData>();
+        }
+        contents = data->bytes.data();
+        size = data->bytes.size();
+    }
+    data->fileSize = size;
+
+    bool decoded = true;
+    switch (type) {
+    case ASSET_TEXTURE:
+    case ASSET_IMAGE:
+        decoded = data->image.loadFromMemory(contents, size);
+        AssetBytes().swap(data->bytes);
+        break;
+    case ASSET_FONT:
+        // sf::Font lee el archivo mientras vive: el mapeo o bytes deben seguir ahi
+        decoded = data->font.loadFromMemory(contents, size);
+        break;
+    case ASSET_BINARY:
+        if (contents != data->bytes.data()) {
+            data->bytes.assign(contents, contents + size);
+        }
+        break;
+    }
+
+    if (!decoded) {
+        return EngineUtilities::TUniquePtr<AssetDetail::AssetData>();
+    }
+    return data;
+}
+
+/**
+ * @brief Takes the decodes the workers finished and completes as many as the upload
+ * budget allows. The rest wait for the next call.
+ */
+void
+AssetManager::update() {
+    if (m_completedCount.load(std::memory_order_acquire) != 0) {
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        for (Decoded& decoded : m_completed) {
+            m_ready.push_back(std::move(decoded));
+        }
+        m_completed.clear();
+        m_completedCount.store(0, std::memory_order_relaxed);
+    }
+
+    std::size_t uploads = 0;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_ready.size(); ++i) {
+        if (!finish(m_ready[i], uploads)) {
+            if (kept != i) {
+                m_ready[kept] = std::move(m_ready[i]);
+            }
+            ++kept;
+        }
+    }
+    m_ready.resize(kept);
+    trim(m_memoryBudget);
+}
+
+void
+AssetManager::waitAll() {
+    while (m_stats.pending > 0) {
+        {
+            std::unique_lock<std::mutex> lock(m_completedMutex);
+            m_completedSignal.wait(lock, [this]() { return !m_completed.empty() || m_stats.pending == m_ready.size(); });
+        }
+        const std::size_t uploadsPerFrame = m_uploadsPerFrame;
+        m_uploadsPerFrame = static_cast<std::size_t>(-1);
+        update();
+        m_uploadsPerFrame = uploadsPerFrame;
+    }
+}
+
+/**
+ * @brief Stores a decode in its slot. Slots freed while their file was loading, which
+ * only happens to failed assets, are skipped by the generation check.
+ */
+bool
+AssetManager::finish(Decoded& decoded, std::size_t& uploads) {
+    Slot& slot = m_slots[decoded.slot];
+    if (!slot.inUse || slot.generation != decoded.generation) {
+        m_stats.pending--;
+        return true;
+    }
+
+    if (!decoded.data.isNull() && slot.type == ASSET_TEXTURE) {
+        if (uploads >= m_uploadsPerFrame) {
+            return false;
+        }
+        ++uploads;
+        if (!decoded.data->texture.loadFromImage(decoded.data->image)) {
+            decoded.data.reset();
+        }
+        else {
+            decoded.data->image = sf::Image();
+        }
+    }
+
+    m_stats.pending--;
+    if (decoded.data.isNull()) {
+        slot.state = ASSET_FAILED;
+        m_stats.failures++;
+        ERROR("AssetManager", "update", slot.path);
+        if (slot.refs == 0) {
+            freeSlot(decoded.slot);
+        }
+        return true;
+    }
+
+    switch (slot.type) {
+    case ASSET_TEXTURE:
+        slot.bytes = imageBytes(decoded.data->texture.getSize());
+        break;
+    case ASSET_IMAGE:
+        slot.bytes = imageBytes(decoded.data->image.getSize());
+        break;
+    case ASSET_FONT:
+    case ASSET_BINARY:
+        slot.bytes = decoded.data->fileSize;
+        break;
+    }
+    slot.data = std::move(decoded.data);
+    slot.state = ASSET_READY;
+    m_stats.residentBytes += slot.bytes;
+    if (slot.refs == 0) {
+        lruPushFront(decoded.slot);
+    }
+    return true;
+}
+
+void
+AssetManager::setMemoryBudget(std::size_t bytes) {
+    m_memoryBudget = bytes;
+    trim(m_memoryBudget);
+}
+
+void
+AssetManager::purgeUnused() {
+    trim(0);
+}
+
+AssetStats
+AssetManager::getStats() const {
+    return m_stats;
+}
+
+void
+AssetManager::addRef(uint32_t slot) {
+    Slot& entry = m_slots[slot];
+    if (entry.refs++ == 0 && entry.inLru) {
+        lruRemove(slot);
+    }
+}
+
+/**
+ * @brief Moves an asset nobody references to the front of the LRU list, or frees it if
+ * it failed.
+ */
+void
+AssetManager::release(uint32_t slot) {
+    Slot& entry = m_slots[slot];
+    if (--entry.refs != 0) {
+        return;
+    }
+
+    if (entry.state == ASSET_READY) {
+        lruPushFront(slot);
+        trim(m_memoryBudget);
+    }
+    else if (entry.state == ASSET_FAILED) {
+        freeSlot(slot);
+    }
+}
+
+void
+AssetManager::lruPushFront(uint32_t slot) {
+    Slot& entry = m_slots[slot];
+    entry.lruPrev = kNone;
+    entry.lruNext = m_lruHead;
+    if (m_lruHead != kNone) {
+        m_slots[m_lruHead].lruPrev = slot;
+    }
+    m_lruHead = slot;
+    if (m_lruTail == kNone) {
+        m_lruTail = slot;
+    }
+    entry.inLru = true;
+    m_stats.cachedBytes += entry.bytes;
+}
+
+void
+AssetManager::lruRemove(uint32_t slot) {
+    Slot& entry = m_slots[slot];
+    if (entry.lruPrev != kNone) {
+        m_slots[entry.lruPrev].lruNext = entry.lruNext;
+    }
+    else {
+        m_lruHead = entry.lruNext;
+    }
+    if (entry.lruNext != kNone) {
+        m_slots[entry.lruNext].lruPrev = entry.lruPrev;
+    }
+    else {
+        m_lruTail = entry.lruPrev;
+    }
+    entry.lruPrev = entry.lruNext = kNone;
+    entry.inLru = false;
+    m_stats.cachedBytes -= entry.bytes;
+}
+
+void
+AssetManager::trim(std::size_t budget) {
+    while (m_stats.residentBytes > budget && m_lruTail != kNone) {
+        const uint32_t victim = m_lruTail;
+        lruRemove(victim);
+        m_stats.residentBytes -= m_slots[victim].bytes;
+        m_stats.evictions++;
+        freeSlot(victim);
+    }
+}
+
+/**
+ * @brief Releases the data and recycles the slot. Its generation changes, so a decode
+ * still in flight for the old asset is dropped by finish().
+ */
+void
+AssetManager::freeSlot(uint32_t slot) {
+    Slot& entry = m_slots[slot];
+    m_slotByPath.erase(makeKey(entry.path, entry.type));
+    entry.data.reset();
+    entry.path.clear();
+    entry.bytes = 0;
+    entry.inUse = false;
+    entry.generation++;
+    m_freeSlots.push_back(slot);
+}
+
+const void*
+AssetManager::getData(uint32_t slot, uint32_t generation) const {
+    const Slot& entry = m_slots[slot];
+    if (entry.generation != generation || entry.state != ASSET_READY) {
+        return nullptr;
+    }
+
+    const AssetDetail::AssetData* data = entry.data.get();
+    switch (entry.type) {
+    case ASSET_TEXTURE:
+        return &data->texture;
+    case ASSET_IMAGE:
+        return &data->image;
+    case ASSET_FONT:
+        return &data->font;
+    case ASSET_BINARY:
+        return &data->bytes;
+    }
+    return nullptr;
+}
+
+AssetState
+AssetManager::getState(uint32_t slot, uint32_t generation) const {
+    const Slot& entry = m_slots[slot];
+    return entry.generation == generation ? entry.state : ASSET_FAILED;
+}
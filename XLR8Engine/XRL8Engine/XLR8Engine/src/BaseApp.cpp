@@ -1,30 +1,146 @@
 #include "BaseApp.h"
 #include "ECS/Actor.h"
+#include "Render/NullRenderBackend.h"
+#include <chrono>
+#include <random>
 
 // Ejecuta el ciclo principal
 int BaseApp::run() {
-    if (!init()) {
-        ERROR("BaseApp", "run", "Initializes result on a false statement",
-            "check method validations");
+    {
+        // La inicializacion cae en el primer frame del profiler
+        XLR8_PROFILE_SCOPE("BaseApp::init");
+        if (!init()) {
+            ERROR("BaseApp", "run", "Initializes result on a false statement, check method validations");
+            return -1;
+        }
     }
 
-    while (m_windowPtr->isOpen()) {
-        m_windowPtr->handleEvents();
-        update();
-        render();
+    auto startTime = std::chrono::steady_clock::now();
+    m_lastFrameTime = startTime;
+
+    while (runFrame()) {
+    }
+
+    if (m_headless) {
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime).count();
+        const RenderStats& stats = m_windowPtr->getTotalStats();
+        std::cout << "frames=" << stats.frames
+            << " seconds=" << seconds
+            << " fps=" << (seconds > 0.0 ? stats.frames / seconds : 0.0)
+            << " drawCalls=" << stats.drawCalls
+            << " vertices=" << stats.vertices
+            << " stateChanges=" << stats.stateChanges << "\n";
+    }
+
+    m_recorder.close();
+
+    if (!m_profilePath.empty()) {
+        Profiler::get().writeSummary(std::cout);
+        if (!Profiler::get().writeChromeTrace(m_profilePath)) {
+            ERROR("BaseApp", "run", "Failed to write the profiler trace");
+        }
     }
 
     destroy();
     return 0;
 }
 
+// Configura el modo sin ventana
+void BaseApp::setHeadless(uint64_t maxFrames) {
+    m_headless = true;
+    m_headlessFrames = maxFrames;
+}
+
+// Activa la captura del profiler
+void BaseApp::setProfileOutput(const std::string& tracePath) {
+    m_profilePath = tracePath;
+    Profiler::get().setCapture(!tracePath.empty());
+}
+
+// Activa la grabacion de frames
+bool BaseApp::setRecordOutput(const std::string& logPath) {
+    return m_recorder.open(logPath);
+}
+
+// Reproduce una sesion grabada sin ventana
+void BaseApp::setReplay(const FrameReplay& replay) {
+    m_replay = replay;
+    m_replaying = true;
+    m_replayFrame = 0;
+    setHeadless(m_replay.getFrameCount());
+}
+
+// Muestra el overlay de estadisticas desde el primer frame
+void BaseApp::setOverlayEnabled(bool enabled) {
+    m_overlayEnabled = enabled;
+}
+
+// Guarda la ruta del stream de telemetria
+void BaseApp::setTelemetryOutput(const std::string& path) {
+    m_telemetryPath = path;
+}
+
+// Una iteracion del ciclo principal
+bool BaseApp::runFrame() {
+    if (!m_windowPtr->isOpen()) {
+        return false;
+    }
+
+    float deltaTime;
+    if (m_replaying) {
+        if (m_replayFrame == m_replay.getFrameCount()) {
+            return false;
+        }
+        const ReplayFrame& frame = m_replay.getFrame(m_replayFrame++);
+        for (const sf::Event& event : frame.events) {
+            m_headlessBackend->queueEvent(event);
+        }
+        deltaTime = frame.deltaTime;
+        m_frameSeed = frame.seed;
+    }
+    else {
+        const auto now = std::chrono::steady_clock::now();
+        deltaTime = std::chrono::duration<float>(now - m_lastFrameTime).count();
+        m_lastFrameTime = now;
+        m_frameSeed = FrameLog::nextSeed(m_frameSeed);
+    }
+
+    m_windowPtr->handleEvents();
+
+    if (m_recorder.isOpen()) {
+        const InputSystem& input = m_windowPtr->getInput();
+        m_frameEvents.clear();
+        for (std::size_t i = 0; i < input.getEventCount(); ++i) {
+            m_frameEvents.push_back(input.getEvent(i));
+        }
+        m_recorder.recordFrame(deltaTime, m_frameSeed, m_frameEvents.data(), m_frameEvents.size());
+    }
+
+    update(deltaTime);
+    render();
+    XLR8_PROFILE_FRAME();
+    return m_windowPtr->isOpen();
+}
+
 // Inicializa la ventana y los actores
 bool BaseApp::init() {
-    m_windowPtr = EngineUtilities::MakeShared<Window>(1920, 1080, "VectonautaEngine");
+    if (m_headless) {
+        m_headlessBackend = new NullRenderBackend(m_headlessFrames);
+        m_windowPtr = EngineUtilities::MakeShared<Window>(m_headlessBackend);
+    }
+    else {
+        m_windowPtr = EngineUtilities::MakeShared<Window>(1920, 1080, "VectonautaEngine");
+    }
     if (!m_windowPtr) {
         ERROR("BaseApp", "init", "Failed to create window pointer, check memory allocation");
         return false;
     }
+    m_windowPtr->setOverlayEnabled(m_overlayEnabled);
+    if (!m_telemetryPath.empty() && !m_windowPtr->getTelemetry().openStream(m_telemetryPath)) {
+        ERROR("BaseApp", "init", "Failed to open the telemetry stream");
+        return false;
+    }
 
     // Crear el Actor
     m_circleActor = EngineUtilities::MakeShared<Actor>("Circle Actor");
@@ -44,23 +160,44 @@ bool BaseApp::init() {
     auto transform = m_circleActor->getComponent<Transform>();
     if (transform) {
         transform->setPosition(sf::Vector2f(200.f, 150.f));
-        transform->setRotation(sf::Vector2f(0.f, 0.f));
+        transform->setRotation(0.f);
         transform->setScale(sf::Vector2f(1.f, 1.f));
     }
+    m_circleActor->bindTransform(m_transformSync);
+    m_actorNames.add(m_circleActor->getNameId(), m_circleActor.get());
+
+    // Una sesion nueva parte de una semilla distinta; una repeticion usa la grabada
+    if (!m_replaying) {
+        std::random_device device;
+        m_frameSeed = (static_cast<uint64_t>(device()) << 32) | device();
+    }
+    m_lastFrameTime = std::chrono::steady_clock::now();
 
     return true;
 }
 
 // L?gica por frame
-void BaseApp::update() {
+void BaseApp::update(float deltaTime) {
+    XLR8_PROFILE_SCOPE("BaseApp::update");
+    m_assets.update();
+    m_behaviours.update(deltaTime);
+    m_tweens.update(deltaTime);
+
     if (m_circleActor) {
-        m_circleActor->update(0.f);
+        // Las particulas salen de la semilla del frame para que una repeticion las reproduzca
+        if (auto emitter = m_circleActor->getComponent<CParticleEmitter>()) {
+            emitter->reseed(m_frameSeed);
+        }
+        m_circleActor->update(deltaTime);
     }
+
+    m_transformSync.flush();
 }
 
 // Render por frame
 void BaseApp::render() {
     if (!m_windowPtr) return;
+    XLR8_PROFILE_SCOPE("BaseApp::render");
 
     m_windowPtr->clear();
 
@@ -74,4 +211,4 @@ void BaseApp::render() {
 // Cleanup
 void BaseApp::destroy() {
     // Smart pointers limpian autom?ticamente
-}
\ No newline at end of file
+}
@@ -0,0 +1,51 @@
+#include "CBehaviour.h"
+#include <algorithm>
+
+/**
+ * @file CBehaviour.cpp
+ * @brief Implementation of the CBehaviour component.
+ */
+
+CBehaviour::CBehaviour(BehaviourScheduler& scheduler)
+    : TComponent(ComponentType::BEHAVIOUR), m_scheduler(&scheduler)
+{
+}
+
+CBehaviour::~CBehaviour() {
+    stopAll();
+}
+
+void CBehaviour::destroy() {
+    stopAll();
+}
+
+/**
+ * @brief Forgets the IDs of finished behaviours before adding the new one, so the list
+ * stays as long as the behaviours actually running.
+ */
+BehaviourId
+CBehaviour::run(BehaviourTask task) {
+    m_behaviours.erase(std::remove_if(m_behaviours.begin(), m_behaviours.end(),
+        [this](BehaviourId id) { return !m_scheduler->isRunning(id); }), m_behaviours.end());
+
+    const BehaviourId id = m_scheduler->start(std::move(task));
+    if (id != 0) {
+        m_behaviours.push_back(id);
+    }
+    return id;
+}
+
+void
+CBehaviour::stopAll() {
+    std::vector<BehaviourId> behaviours;
+    behaviours.swap(m_behaviours);
+    for (BehaviourId id : behaviours) {
+        m_scheduler->stop(id);
+    }
+}
+
+std::size_t
+CBehaviour::getRunningCount() const {
+    return static_cast<std::size_t>(std::count_if(m_behaviours.begin(), m_behaviours.end(),
+        [this](BehaviourId id) { return m_scheduler->isRunning(id); }));
+}
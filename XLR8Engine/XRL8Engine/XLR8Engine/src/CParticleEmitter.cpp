@@ -0,0 +1,118 @@
+#include "CParticleEmitter.h"
+#include "Window.h"
+#include "Math/ConstMath.h"
+#include "Math/VectorMath.h"
+#include "Core/FrameLog.h"
+#include <cmath>
+
+/**
+ * @file CParticleEmitter.cpp
+ * @brief Implementation of the CParticleEmitter component.
+ */
+
+namespace {
+    uint32_t g_emitterCount = 0; ///< Da a cada emisor un ID distinto por orden de creacion.
+}
+
+CParticleEmitter::CParticleEmitter()
+    : TComponent(ComponentType::PARTICLE_EMITTER), m_emitterId(++g_emitterCount) {
+    reseed(0);
+}
+
+CParticleEmitter::CParticleEmitter(const EngineUtilities::TSharedPointer<ParticleSystem>& system,
+    const ParticleEmitterSettings& settings)
+    : TComponent(ComponentType::PARTICLE_EMITTER), m_system(system), m_settings(settings),
+    m_emitterId(++g_emitterCount) {
+    reseed(0);
+}
+
+/**
+ * @brief Mixes the seed and the ID with splitmix64, so neighbouring IDs and seeds still
+ * give unrelated sequences.
+ */
+void
+CParticleEmitter::reseed(uint64_t frameSeed) {
+    const uint64_t mixed = FrameLog::nextSeed(frameSeed ^ (static_cast<uint64_t>(m_emitterId) * 0x9E3779B97F4A7C15ull));
+    m_random = static_cast<uint32_t>(mixed >> 32);
+    // xorshift nunca sale del estado cero
+    if (m_random == 0) {
+        m_random = 0x9E3779B9u;
+    }
+}
+
+/**
+ * @brief Spawns the particles the rate accumulated since the last frame.
+ *
+ * @param deltaTime Time elapsed since the last frame.
+ */
+void
+CParticleEmitter::update(float deltaTime) {
+    if (!m_emitting) {
+        return;
+    }
+
+    m_accumulator += m_settings.rate * deltaTime;
+    const float whole = std::floor(m_accumulator);
+    m_accumulator -= whole;
+    if (whole > 0.f) {
+        burst(static_cast<std::size_t>(whole));
+    }
+}
+
+/**
+ * @brief Spawns a group of particles.
+ *
+ * The directions of the whole group go through one VectorMath::sinCos batch and are then
+ * rotated by the emitter transform.
+ */
+void
+CParticleEmitter::burst(std::size_t count) {
+    if (!m_system || count == 0) {
+        return;
+    }
+
+    m_angles.resize(count);
+    m_sines.resize(count);
+    m_cosines.resize(count);
+    const float halfSpread = m_settings.spread * 0.5f;
+    for (std::size_t i = 0; i < count; ++i) {
+        m_angles[i] = VectorMath::wrapDegrees(m_settings.direction + random(-halfSpread, halfSpread)) *
+            ConstMath::DEG_TO_RAD;
+    }
+    VectorMath::sinCos(m_angles.data(), m_sines.data(), m_cosines.data(), count);
+
+    const float* matrix = m_transform.getMatrix();
+    const sf::Vector2f origin(matrix[12], matrix[13]);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float speed = random(m_settings.speedMin, m_settings.speedMax);
+        const sf::Vector2f local(m_cosines[i] * speed, m_sines[i] * speed);
+        const sf::Vector2f velocity(matrix[0] * local.x + matrix[4] * local.y,
+            matrix[1] * local.x + matrix[5] * local.y);
+        m_system->spawn(origin, velocity,
+            random(m_settings.lifetimeMin, m_settings.lifetimeMax),
+            random(m_settings.sizeMin, m_settings.sizeMax),
+            m_settings.color);
+    }
+}
+
+/**
+ * @brief Sets the position of the emitter.
+ *
+ * @param position The position as a 2D vector.
+ */
+void
+CParticleEmitter::setPosition(const sf::Vector2f& position) {
+    m_transform = sf::Transform();
+    m_transform.translate(position.x, position.y);
+}
+
+/**
+ * @brief xorshift32, fast and good enough for visual randomness.
+ */
+float
+CParticleEmitter::random(float min, float max) {
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+    return min + (max - min) * (static_cast<float>(m_random >> 8) * (1.f / 16777216.f));
+}
@@ -1,15 +1,35 @@
 ﻿#include "CShape.h"
 #include "Window.h"
+#include "Math/VectorMath.h"
+#include "Math/ShapePresets.h"
 
 /**
  * @file CShape.cpp
  * @brief Implementation of the CShape class for creating and manipulating different SFML shapes.
  */
 
+ /**
+  * @brief Builds a white convex shape from a compile-time outline.
+  *
+  * The points are copied from constant tables, so no trigonometry runs when a shape is
+  * created or when its outline is read back for rendering.
+  */
+template<std::size_t PointCount>
+static EngineUtilities::TSharedPointer<sf::Shape>
+createConvexShape(const std::array<CVector2, PointCount>& points) {
+    auto convexSP = EngineUtilities::MakeShared<sf::ConvexShape>(PointCount);
+    for (std::size_t i = 0; i < PointCount; ++i) {
+        convexSP->setPoint(i, points[i].toVector2f());
+    }
+    convexSP->setFillColor(sf::Color::White);
+    return convexSP.dynamic_pointer_cast<sf::Shape>();
+}
+
  /**
   * @brief Creates a shape of the specified type.
   *
   * Allocates and configures a shape (Circle, Rectangle, Triangle, or Polygon) based on the given shape type.
+  * Circle, triangle and polygon outlines come from the constexpr tables in ShapePresets.h.
   * The shape is stored internally using a shared pointer.
   *
   * @param shapeType The type of shape to create.
@@ -17,38 +37,25 @@
 void
 CShape::createShape(ShapeType type) {
     m_shapeType = type;
+    m_mesh.reset();
 
     switch (type) {
     case ShapeType::CIRCLE: {
-        auto circleSP = EngineUtilities::MakeShared<sf::CircleShape>(10.f);
-        circleSP->setFillColor(sf::Color::White);
-        m_shapePtr = circleSP.dynamic_pointer_cast<sf::Shape>();
+        m_shapePtr = createConvexShape(ShapePresets::kCircle);
         break;
     }
     case ShapeType::RECTANGLE: {
-        auto rectangleSP = EngineUtilities::MakeShared<sf::RectangleShape>(sf::Vector2f(100.f, 50.f));
+        auto rectangleSP = EngineUtilities::MakeShared<sf::RectangleShape>(ShapePresets::kRectangleSize.toVector2f());
         rectangleSP->setFillColor(sf::Color::White);
         m_shapePtr = rectangleSP.dynamic_pointer_cast<sf::Shape>();
         break;
     }
     case ShapeType::TRIANGLE: {
-        auto triangleSP = EngineUtilities::MakeShared<sf::ConvexShape>(3);
-        triangleSP->setPoint(0, sf::Vector2f(0.f, 0.f));
-        triangleSP->setPoint(1, sf::Vector2f(50.f, 100.f));
-        triangleSP->setPoint(2, sf::Vector2f(100.f, 0.f));
-        triangleSP->setFillColor(sf::Color::White);
-        m_shapePtr = triangleSP.dynamic_pointer_cast<sf::Shape>();
+        m_shapePtr = createConvexShape(ShapePresets::kTriangle);
         break;
     }
     case ShapeType::POLYGON: {
-        auto polygonSP = EngineUtilities::MakeShared<sf::ConvexShape>(5);
-        polygonSP->setPoint(0, sf::Vector2f(0.f, 0.f));
-        polygonSP->setPoint(1, sf::Vector2f(50.f, 100.f));
-        polygonSP->setPoint(2, sf::Vector2f(100.f, 0.f));
-        polygonSP->setPoint(3, sf::Vector2f(75.f, -50.f));
-        polygonSP->setPoint(4, sf::Vector2f(-25.f, -50.f));
-        polygonSP->setFillColor(sf::Color::White);
-        m_shapePtr = polygonSP.dynamic_pointer_cast<sf::Shape>();
+        m_shapePtr = createConvexShape(ShapePresets::kPentagon);
         break;
     }
     default:
@@ -58,35 +65,104 @@ CShape::createShape(ShapeType type) {
     }
 }
 
-CShape::CShape(ShapeType shapeType)
-{
+/**
+ * @brief Creates a polygon from an arbitrary outline.
+ *
+ * The SFML convex shape only stores the outline and the fill color; it is never drawn
+ * directly, so a concave outline is fine. Drawing uses the cached triangulation.
+ *
+ * With fewer than 3 points it logs an error and leaves the shape unchanged.
+ *
+ * @param points Outline in local space.
+ */
+void
+CShape::createPolygon(const std::vector<sf::Vector2f>& points) {
+    if (points.size() < 3) {
+        ERROR("CShape", "createPolygon", "A polygon needs at least 3 points");
+        return;
+    }
+
+    auto polygonSP = EngineUtilities::MakeShared<sf::ConvexShape>(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        polygonSP->setPoint(i, points[i]);
+    }
+    polygonSP->setFillColor(sf::Color::White);
+
+    m_shapeType = ShapeType::POLYGON;
+    m_shapePtr = polygonSP.dynamic_pointer_cast<sf::Shape>();
+    m_mesh = TessellationCache::getShared().acquire(points);
 }
 
-void CShape::start() {
-    // Tu l�gica aqu�
+CShape::CShape() : TComponent(ComponentType::SHAPE)
+{
 }
 
-void
-CShape::update(float deltaTime) {
-    // Future logic for animation or state change
+CShape::CShape(ShapeType shapeType) : TComponent(ComponentType::SHAPE)
+{
+    createShape(shapeType);
 }
 
 /**
- * @brief Renders the shape using the given window.
+ * @brief Submits the shape to the window's render queue.
+ *
+ * Polygons built by createPolygon() expand the cached index buffer: the outline is
+ * transformed once, then every index copies its world point. The convex presets of
+ * createShape() are triangulated as a fan.
  *
  * @param window Shared pointer to the window object.
  */
 void
 CShape::render(const EngineUtilities::TSharedPointer<Window>& window) {
-    if (m_shapePtr) {
-        window->draw(*m_shapePtr);
+    if (!m_shapePtr) {
+        return;
+    }
+
+    RenderQueue& queue = window->getRenderQueue();
+    const sf::Transform& transform = m_transform;
+    const sf::Color color = m_shapePtr->getFillColor();
 
+    if (m_mesh) {
+        const std::size_t indexCount = m_mesh->indices.size();
+        if (indexCount == 0) {
+            return;
+        }
+
+        // Puntos de mundo reutilizados entre formas para no reservar memoria por frame
+        static thread_local std::vector<sf::Vector2f> worldPoints;
+        worldPoints.resize(m_mesh->points.size());
+        for (std::size_t i = 0; i < worldPoints.size(); ++i) {
+            worldPoints[i] = transform.transformPoint(m_mesh->points[i]);
+        }
+
+        sf::Vertex* vertices = queue.allocate(RenderKey::make(m_layer, m_blendType, 0, m_depth), indexCount);
+        const uint32_t* indices = m_mesh->indices.data();
+        for (std::size_t i = 0; i < indexCount; ++i) {
+            vertices[i].position = worldPoints[indices[i]];
+            vertices[i].color = color;
+            vertices[i].texCoords = sf::Vector2f(0.f, 0.f);
+        }
+        return;
     }
-}
 
-void
-CShape::destroy() {
+    const std::size_t pointCount = m_shapePtr->getPointCount();
+    if (pointCount < 3) {
+        return;
+    }
+
+    sf::Vertex* vertices = queue.allocate(RenderKey::make(m_layer, m_blendType, 0, m_depth),
+        (pointCount - 2) * 3);
+    const sf::Vector2f center = transform.transformPoint(m_shapePtr->getPoint(0));
+    sf::Vector2f previous = transform.transformPoint(m_shapePtr->getPoint(1));
+
+    for (std::size_t i = 2; i < pointCount; ++i) {
+        const sf::Vector2f current = transform.transformPoint(m_shapePtr->getPoint(i));
+        *vertices++ = sf::Vertex(center, color);
+        *vertices++ = sf::Vertex(previous, color);
+        *vertices++ = sf::Vertex(current, color);
+        previous = current;
+    }
 }
+
 /**
  * @brief Sets the position of the shape.
  *
@@ -95,8 +171,8 @@ CShape::destroy() {
  */
 void
 CShape::setPosition(float x, float y) {
-    if (m_shapePtr) m_shapePtr->setPosition(x, y);
-    else ERROR("CShape", "setPosition", "Shape is not initialized.");
+    m_transformable.setPosition(x, y);
+    updateTransform();
 }
 
 /**
@@ -104,6 +180,11 @@ CShape::setPosition(float x, float y) {
  *
  * @param position The position as a 2D vector.
  */
+void
+CShape::setPosition(const sf::Vector2f& position) {
+    m_transformable.setPosition(position);
+    updateTransform();
+}
 
  /**
   * @brief Sets the fill color of the shape.
@@ -116,6 +197,16 @@ CShape::setFillColor(const sf::Color& color) {
     else ERROR("CShape", "setFillColor", "Shape is not initialized.");
 }
 
+/**
+ * @brief Gets the fill color of the shape.
+ *
+ * @return The fill color, or transparent if the shape is not initialized.
+ */
+sf::Color
+CShape::getFillColor() const {
+    return m_shapePtr ? m_shapePtr->getFillColor() : sf::Color::Transparent;
+}
+
 /**
  * @brief Sets the rotation angle of the shape.
  *
@@ -123,8 +214,8 @@ CShape::setFillColor(const sf::Color& color) {
  */
 void
 CShape::SetRotation(float angle) {
-    if (m_shapePtr) m_shapePtr->setRotation(angle);
-    else ERROR("CShape", "setRotation", "Shape is not initialized.");
+    m_transformable.setRotation(angle);
+    updateTransform();
 }
 
 /**
@@ -134,6 +225,15 @@ CShape::SetRotation(float angle) {
  */
 void
 CShape::setScale(const sf::Vector2f& scale) {
-    if (m_shapePtr) m_shapePtr->setScale(scale);
-    else ERROR("CShape", "setScale", "Shape is not initialized.");
-}
\ No newline at end of file
+    m_transformable.setScale(scale);
+    updateTransform();
+}
+
+/**
+ * @brief Rebuilds the render matrix from the position, rotation and scale setters.
+ */
+void
+CShape::updateTransform() {
+    m_transform = VectorMath::composeTransform(m_transformable.getPosition(),
+        m_transformable.getRotation(), m_transformable.getScale());
+}
@@ -0,0 +1,128 @@
+#include "CSprite.h"
+#include "Window.h"
+#include "Math/VectorMath.h"
+
+/**
+ * @file CSprite.cpp
+ * @brief Implementation of the CSprite component.
+ */
+
+CSprite::CSprite() : TComponent(ComponentType::SPRITE)
+{
+}
+
+CSprite::CSprite(const AtlasRegion& region) : TComponent(ComponentType::SPRITE)
+{
+    setRegion(region);
+}
+
+/**
+ * @brief Submits the sprite quad to the window's render queue.
+ *
+ * The quad covers the region rectangle in local space and uses it as texture coordinates.
+ *
+ * @param window Shared pointer to the window object.
+ */
+void
+CSprite::render(const EngineUtilities::TSharedPointer<Window>& window) {
+    if (m_region.texture == nullptr) {
+        return;
+    }
+
+    RenderQueue& queue = window->getRenderQueue();
+    const uint32_t materialId = queue.getMaterialId(m_region.texture);
+    sf::Vertex* vertices = queue.allocate(RenderKey::make(m_layer, m_blendType, materialId, m_depth),
+        6, m_region.texture);
+
+    const sf::Transform& transform = m_transform;
+    const float width = static_cast<float>(m_region.rect.width);
+    const float height = static_cast<float>(m_region.rect.height);
+    const float left = static_cast<float>(m_region.rect.left);
+    const float top = static_cast<float>(m_region.rect.top);
+
+    const sf::Vertex topLeft(transform.transformPoint(0.f, 0.f), m_color, sf::Vector2f(left, top));
+    const sf::Vertex topRight(transform.transformPoint(width, 0.f), m_color, sf::Vector2f(left + width, top));
+    const sf::Vertex bottomRight(transform.transformPoint(width, height), m_color, sf::Vector2f(left + width, top + height));
+    const sf::Vertex bottomLeft(transform.transformPoint(0.f, height), m_color, sf::Vector2f(left, top + height));
+
+    vertices[0] = topLeft;
+    vertices[1] = topRight;
+    vertices[2] = bottomRight;
+    vertices[3] = topLeft;
+    vertices[4] = bottomRight;
+    vertices[5] = bottomLeft;
+}
+
+/**
+ * @brief Sets the atlas region shown by the sprite.
+ *
+ * @param region Region from a built TextureAtlas.
+ */
+void
+CSprite::setRegion(const AtlasRegion& region) {
+    m_region = region;
+}
+
+/**
+ * @brief Sets the position of the sprite.
+ *
+ * @param x X coordinate.
+ * @param y Y coordinate.
+ */
+void
+CSprite::setPosition(float x, float y) {
+    m_transformable.setPosition(x, y);
+    updateTransform();
+}
+
+/**
+ * @brief Sets the position of the sprite using a vector.
+ *
+ * @param position The position as a 2D vector.
+ */
+void
+CSprite::setPosition(const sf::Vector2f& position) {
+    m_transformable.setPosition(position);
+    updateTransform();
+}
+
+/**
+ * @brief Sets the color that modulates the texture.
+ *
+ * @param color The color to apply.
+ */
+void
+CSprite::setColor(const sf::Color& color) {
+    m_color = color;
+}
+
+/**
+ * @brief Sets the rotation angle of the sprite.
+ *
+ * @param angle The rotation angle in degrees.
+ */
+void
+CSprite::SetRotation(float angle) {
+    m_transformable.setRotation(angle);
+    updateTransform();
+}
+
+/**
+ * @brief Sets the scale of the sprite.
+ *
+ * @param scale The scaling factor as a 2D vector.
+ */
+void
+CSprite::setScale(const sf::Vector2f& scale) {
+    m_transformable.setScale(scale);
+    updateTransform();
+}
+
+/**
+ * @brief Rebuilds the render matrix from the position, rotation and scale setters.
+ */
+void
+CSprite::updateTransform() {
+    m_transform = VectorMath::composeTransform(m_transformable.getPosition(),
+        m_transformable.getRotation(), m_transformable.getScale());
+}
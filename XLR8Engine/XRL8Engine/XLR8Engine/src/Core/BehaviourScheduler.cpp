@@ -0,0 +1,216 @@
+#include "Core/BehaviourScheduler.h"
+#include <algorithm>
+#include <exception>
+#include <functional>
+
+/**
+ * @file BehaviourScheduler.cpp
+ * @brief Implementation of the behaviour scheduler and its awaitables.
+ */
+
+void
+BehaviourTask::promise_type::unhandled_exception() {
+    try {
+        throw;
+    }
+    catch (const std::exception& exception) {
+        ERROR("BehaviourTask", "unhandled_exception", exception.what());
+    }
+    catch (...) {
+        ERROR("BehaviourTask", "unhandled_exception", "Unknown exception");
+    }
+}
+
+void
+WaitSeconds::await_suspend(BehaviourTask::Handle handle) const {
+    BehaviourScheduler& scheduler = *handle.promise().scheduler;
+    const uint32_t slot = handle.promise().slot;
+    scheduler.m_timers.push_back({ scheduler.m_time + seconds,
+        BehaviourScheduler::makeId(slot, scheduler.m_slots[slot].generation) });
+    std::push_heap(scheduler.m_timers.begin(), scheduler.m_timers.end(), std::greater<>());
+}
+
+void
+WaitNextFrame::await_suspend(BehaviourTask::Handle handle) const {
+    BehaviourScheduler& scheduler = *handle.promise().scheduler;
+    const uint32_t slot = handle.promise().slot;
+    scheduler.m_nextFrame.push_back(BehaviourScheduler::makeId(slot, scheduler.m_slots[slot].generation));
+}
+
+/**
+ * @brief An unknown event is reported and waited as a single frame, so the behaviour
+ * cannot hang on it.
+ */
+void
+WaitForEvent::await_suspend(BehaviourTask::Handle handle) const {
+    BehaviourScheduler& scheduler = *handle.promise().scheduler;
+    const uint32_t slot = handle.promise().slot;
+    const BehaviourId id = BehaviourScheduler::makeId(slot, scheduler.m_slots[slot].generation);
+    if (event >= scheduler.m_eventWaiters.size()) {
+        ERROR("WaitForEvent", "await_suspend", "Unknown event " + std::to_string(event));
+        scheduler.m_nextFrame.push_back(id);
+        return;
+    }
+    scheduler.m_eventWaiters[event].push_back(id);
+    scheduler.m_slots[slot].waitEvent = event;
+}
+
+BehaviourScheduler::~BehaviourScheduler() {
+    for (Slot& slot : m_slots) {
+        if (slot.handle) {
+            BehaviourTask::Handle handle = slot.handle;
+            slot.handle = nullptr;
+            handle.destroy();
+        }
+    }
+    m_running = 0;
+}
+
+BehaviourId
+BehaviourScheduler::start(BehaviourTask task) {
+    BehaviourTask::Handle handle = task.m_handle;
+    task.m_handle = nullptr;
+    if (!handle) {
+        return 0;
+    }
+
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        slot = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+    m_slots[slot].handle = handle;
+    handle.promise().scheduler = this;
+    handle.promise().slot = slot;
+    m_running++;
+
+    const BehaviourId id = makeId(slot, m_slots[slot].generation);
+    resume(id);
+    return isRunning(id) ? id : 0;
+}
+
+void
+BehaviourScheduler::stop(BehaviourId id) {
+    Slot* slot = findSlot(id);
+    if (slot == nullptr) {
+        return;
+    }
+    if (slot->resuming) {
+        slot->stopRequested = true;
+        return;
+    }
+    release(static_cast<uint32_t>(id));
+}
+
+bool
+BehaviourScheduler::isRunning(BehaviourId id) const {
+    const uint32_t index = static_cast<uint32_t>(id);
+    return index < m_slots.size() && m_slots[index].handle &&
+        m_slots[index].generation == static_cast<uint32_t>(id >> 32);
+}
+
+BehaviourEventId
+BehaviourScheduler::registerEvent(const std::string& name) {
+    for (std::size_t i = 0; i < m_eventNames.size(); ++i) {
+        if (m_eventNames[i] == name) {
+            return static_cast<BehaviourEventId>(i);
+        }
+    }
+    m_eventNames.push_back(name);
+    m_eventWaiters.emplace_back();
+    return static_cast<BehaviourEventId>(m_eventNames.size() - 1);
+}
+
+void
+BehaviourScheduler::signal(BehaviourEventId event) {
+    if (event >= m_eventWaiters.size()) {
+        return;
+    }
+    std::vector<BehaviourId>& waiters = m_eventWaiters[event];
+    for (BehaviourId id : waiters) {
+        if (Slot* slot = findSlot(id)) {
+            slot->waitEvent = kNoEvent;
+            m_ready.push_back(id);
+        }
+    }
+    waiters.clear();
+}
+
+/**
+ * @brief Only the behaviours due this frame are touched: the next-frame list, the expired
+ * top of the timer heap and those signalled since the previous update. The ready list is
+ * swapped out before resuming, so signals raised while they run wait for the next update.
+ */
+void
+BehaviourScheduler::update(float deltaTime) {
+    XLR8_PROFILE_SCOPE("BehaviourScheduler::update");
+    m_time += deltaTime;
+
+    m_ready.insert(m_ready.end(), m_nextFrame.begin(), m_nextFrame.end());
+    m_nextFrame.clear();
+    while (!m_timers.empty() && m_timers.front().wakeTime <= m_time) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+        m_ready.push_back(m_timers.back().id);
+        m_timers.pop_back();
+    }
+
+    // Lo que despierten las corrutinas va a m_ready y espera al siguiente update
+    m_resuming.swap(m_ready);
+    for (BehaviourId id : m_resuming) {
+        resume(id);
+    }
+    m_resuming.clear();
+}
+
+BehaviourScheduler::Slot*
+BehaviourScheduler::findSlot(BehaviourId id) {
+    const uint32_t index = static_cast<uint32_t>(id);
+    const uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (index >= m_slots.size() || !m_slots[index].handle || m_slots[index].generation != generation) {
+        return nullptr;
+    }
+    return &m_slots[index];
+}
+
+void
+BehaviourScheduler::resume(BehaviourId id) {
+    Slot* slot = findSlot(id);
+    if (slot == nullptr || slot->resuming) {
+        return;
+    }
+    const uint32_t index = static_cast<uint32_t>(id);
+    BehaviourTask::Handle handle = slot->handle;
+    slot->resuming = true;
+    handle.resume();
+
+    // La corrutina puede haber iniciado otras y movido m_slots
+    Slot& resumed = m_slots[index];
+    resumed.resuming = false;
+    if (handle.done() || resumed.stopRequested) {
+        release(index);
+    }
+}
+
+void
+BehaviourScheduler::release(uint32_t index) {
+    Slot& slot = m_slots[index];
+    if (slot.waitEvent != kNoEvent) {
+        std::vector<BehaviourId>& waiters = m_eventWaiters[slot.waitEvent];
+        waiters.erase(std::remove(waiters.begin(), waiters.end(), makeId(index, slot.generation)), waiters.end());
+    }
+
+    BehaviourTask::Handle handle = slot.handle;
+    slot.handle = nullptr;
+    slot.generation++;
+    slot.waitEvent = kNoEvent;
+    slot.stopRequested = false;
+    m_freeSlots.push_back(index);
+    m_running--;
+
+    // Los destructores del frame pueden volver a llamar al scheduler
+    handle.destroy();
+}
@@ -0,0 +1,400 @@
+#include "Core/FrameLog.h"
+#include <cstring>
+
+/**
+ * @file FrameLog.cpp
+ * @brief Encoding and decoding of the frame log.
+ */
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 6)
+#define XLR8_EVENT_HAS_SCANCODE 1
+#else
+#define XLR8_EVENT_HAS_SCANCODE 0
+#endif
+
+namespace {
+    const char kMagic[4] = { 'X', 'R', 'P', 'L' }; ///< First bytes of every log.
+    const uint32_t kVersion = 1;                  ///< Layout version written by this build.
+    const uint8_t kHasDeltaTime = 1u << 0;        ///< Frame flag: a delta time follows.
+    const uint8_t kHasSeed = 1u << 1;             ///< Frame flag: a seed follows.
+    const std::size_t kFlushBytes = 64u << 10;    ///< Buffered bytes before a write.
+
+    void
+        writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    void
+        writeSigned(std::vector<uint8_t>& out, int64_t value) {
+        writeVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void
+        writeFixed(std::vector<uint8_t>& out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void
+        writeFloat(std::vector<uint8_t>& out, float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeFixed(out, bits, 4);
+    }
+
+    /**
+     * @struct Reader
+     * @brief Cursor over a loaded log. Any read past the end clears ok and returns zero.
+     */
+    struct
+        Reader {
+        const uint8_t* data; ///< Posicion actual.
+        const uint8_t* end;  ///< Fin del log.
+        bool ok = true;      ///< false tras leer fuera del log o un valor invalido.
+
+        uint64_t
+            varint() {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (data == end) {
+                    ok = false;
+                    return 0;
+                }
+                const uint8_t byte = *data++;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return value;
+                }
+            }
+            ok = false;
+            return 0;
+        }
+
+        int64_t
+            signedVarint() {
+            const uint64_t value = varint();
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        int
+            integer() { return static_cast<int>(signedVarint()); }
+
+        unsigned
+            count() { return static_cast<unsigned>(varint()); }
+
+        uint64_t
+            fixed(int bytes) {
+            if (end - data < bytes) {
+                ok = false;
+                data = end;
+                return 0;
+            }
+            uint64_t value = 0;
+            for (int i = 0; i < bytes; ++i) {
+                value |= static_cast<uint64_t>(data[i]) << (8 * i);
+            }
+            data += bytes;
+            return value;
+        }
+
+        float
+            real() {
+            const uint32_t bits = static_cast<uint32_t>(fixed(4));
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    };
+
+    void
+        writeEvent(std::vector<uint8_t>& out, const sf::Event& event) {
+        writeVarint(out, static_cast<uint64_t>(event.type));
+        switch (event.type) {
+        case sf::Event::Resized:
+            writeVarint(out, event.size.width);
+            writeVarint(out, event.size.height);
+            break;
+        case sf::Event::TextEntered:
+            writeVarint(out, event.text.unicode);
+            break;
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+            writeSigned(out, event.key.code);
+#if XLR8_EVENT_HAS_SCANCODE
+            writeSigned(out, event.key.scancode);
+#endif
+            out.push_back(static_cast<uint8_t>((event.key.alt ? 1 : 0) | (event.key.control ? 2 : 0) |
+                (event.key.shift ? 4 : 0) | (event.key.system ? 8 : 0)));
+            break;
+        case sf::Event::MouseWheelMoved:
+            writeSigned(out, event.mouseWheel.delta);
+            writeSigned(out, event.mouseWheel.x);
+            writeSigned(out, event.mouseWheel.y);
+            break;
+        case sf::Event::MouseWheelScrolled:
+            writeVarint(out, event.mouseWheelScroll.wheel);
+            writeFloat(out, event.mouseWheelScroll.delta);
+            writeSigned(out, event.mouseWheelScroll.x);
+            writeSigned(out, event.mouseWheelScroll.y);
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            writeVarint(out, event.mouseButton.button);
+            writeSigned(out, event.mouseButton.x);
+            writeSigned(out, event.mouseButton.y);
+            break;
+        case sf::Event::MouseMoved:
+            writeSigned(out, event.mouseMove.x);
+            writeSigned(out, event.mouseMove.y);
+            break;
+        case sf::Event::JoystickButtonPressed:
+        case sf::Event::JoystickButtonReleased:
+            writeVarint(out, event.joystickButton.joystickId);
+            writeVarint(out, event.joystickButton.button);
+            break;
+        case sf::Event::JoystickMoved:
+            writeVarint(out, event.joystickMove.joystickId);
+            writeVarint(out, event.joystickMove.axis);
+            writeFloat(out, event.joystickMove.position);
+            break;
+        case sf::Event::JoystickConnected:
+        case sf::Event::JoystickDisconnected:
+            writeVarint(out, event.joystickConnect.joystickId);
+            break;
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+            writeVarint(out, event.touch.finger);
+            writeSigned(out, event.touch.x);
+            writeSigned(out, event.touch.y);
+            break;
+        case sf::Event::SensorChanged:
+            writeVarint(out, event.sensor.type);
+            writeFloat(out, event.sensor.x);
+            writeFloat(out, event.sensor.y);
+            writeFloat(out, event.sensor.z);
+            break;
+        default:
+            // Closed, LostFocus, GainedFocus, MouseEntered, MouseLeft: sin datos
+            break;
+        }
+    }
+
+    bool
+        readEvent(Reader& in, sf::Event& event) {
+        std::memset(&event, 0, sizeof(event));
+        const uint64_t type = in.varint();
+        if (type >= sf::Event::Count) {
+            return false;
+        }
+        event.type = static_cast<sf::Event::EventType>(type);
+
+        switch (event.type) {
+        case sf::Event::Resized:
+            event.size.width = in.count();
+            event.size.height = in.count();
+            break;
+        case sf::Event::TextEntered:
+            event.text.unicode = static_cast<sf::Uint32>(in.varint());
+            break;
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased: {
+            event.key.code = static_cast<sf::Keyboard::Key>(in.integer());
+#if XLR8_EVENT_HAS_SCANCODE
+            event.key.scancode = static_cast<sf::Keyboard::Scancode>(in.integer());
+#endif
+            const uint64_t modifiers = in.fixed(1);
+            event.key.alt = (modifiers & 1) != 0;
+            event.key.control = (modifiers & 2) != 0;
+            event.key.shift = (modifiers & 4) != 0;
+            event.key.system = (modifiers & 8) != 0;
+            break;
+        }
+        case sf::Event::MouseWheelMoved:
+            event.mouseWheel.delta = in.integer();
+            event.mouseWheel.x = in.integer();
+            event.mouseWheel.y = in.integer();
+            break;
+        case sf::Event::MouseWheelScrolled:
+            event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(in.count());
+            event.mouseWheelScroll.delta = in.real();
+            event.mouseWheelScroll.x = in.integer();
+            event.mouseWheelScroll.y = in.integer();
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            event.mouseButton.button = static_cast<sf::Mouse::Button>(in.count());
+            event.mouseButton.x = in.integer();
+            event.mouseButton.y = in.integer();
+            break;
+        case sf::Event::MouseMoved:
+            event.mouseMove.x = in.integer();
+            event.mouseMove.y = in.integer();
+            break;
+        case sf::Event::JoystickButtonPressed:
+        case sf::Event::JoystickButtonReleased:
+            event.joystickButton.joystickId = in.count();
+            event.joystickButton.button = in.count();
+            break;
+        case sf::Event::JoystickMoved:
+            event.joystickMove.joystickId = in.count();
+            event.joystickMove.axis = static_cast<sf::Joystick::Axis>(in.count());
+            event.joystickMove.position = in.real();
+            break;
+        case sf::Event::JoystickConnected:
+        case sf::Event::JoystickDisconnected:
+            event.joystickConnect.joystickId = in.count();
+            break;
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+            event.touch.finger = in.count();
+            event.touch.x = in.integer();
+            event.touch.y = in.integer();
+            break;
+        case sf::Event::SensorChanged:
+            event.sensor.type = static_cast<sf::Sensor::Type>(in.count());
+            event.sensor.x = in.real();
+            event.sensor.y = in.real();
+            event.sensor.z = in.real();
+            break;
+        default:
+            break;
+        }
+        return in.ok;
+    }
+}
+
+namespace FrameLog {
+
+    uint64_t
+        nextSeed(uint64_t seed) {
+        uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+bool
+FrameRecorder::open(const std::string& path) {
+    close();
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        ERROR("FrameRecorder", "open", path);
+        return false;
+    }
+
+    m_buffer.clear();
+    m_buffer.reserve(kFlushBytes + 1024);
+    m_buffer.insert(m_buffer.end(), kMagic, kMagic + sizeof(kMagic));
+    writeFixed(m_buffer, kVersion, 4);
+    m_lastDeltaTime = 0.f;
+    m_lastSeed = 0;
+    m_frameCount = 0;
+    return true;
+}
+
+void
+FrameRecorder::close() {
+    if (!m_file.is_open()) {
+        return;
+    }
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+    m_file.close();
+}
+
+/**
+ * @brief Encodes the frame into the buffer; the file is only written every few dozen
+ * kilobytes, so recording adds no I/O to most frames.
+ */
+void
+FrameRecorder::recordFrame(float deltaTime, uint64_t seed, const sf::Event* events, std::size_t eventCount) {
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    // Compara los bits: -0.f y NaN tambien deben reproducirse exactos
+    const bool sameDeltaTime = m_frameCount != 0 &&
+        std::memcmp(&deltaTime, &m_lastDeltaTime, sizeof(float)) == 0;
+    const bool predictedSeed = m_frameCount != 0 && seed == FrameLog::nextSeed(m_lastSeed);
+
+    m_buffer.push_back(static_cast<uint8_t>((sameDeltaTime ? 0 : kHasDeltaTime) | (predictedSeed ? 0 : kHasSeed)));
+    if (!sameDeltaTime) {
+        writeFloat(m_buffer, deltaTime);
+    }
+    if (!predictedSeed) {
+        writeFixed(m_buffer, seed, 8);
+    }
+    writeVarint(m_buffer, eventCount);
+    for (std::size_t i = 0; i < eventCount; ++i) {
+        writeEvent(m_buffer, events[i]);
+    }
+
+    m_lastDeltaTime = deltaTime;
+    m_lastSeed = seed;
+    m_frameCount++;
+
+    if (m_buffer.size() >= kFlushBytes) {
+        m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+bool
+FrameReplay::load(const std::string& path) {
+    m_frames.clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        ERROR("FrameReplay", "load", path);
+        return false;
+    }
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    Reader in{ bytes.data(), bytes.data() + bytes.size() };
+    if (bytes.size() < sizeof(kMagic) + 4 || std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0) {
+        ERROR("FrameReplay", "load", "not a frame log: " + path);
+        return false;
+    }
+    in.data += sizeof(kMagic);
+    if (in.fixed(4) != kVersion) {
+        ERROR("FrameReplay", "load", "unsupported frame log version: " + path);
+        return false;
+    }
+
+    float deltaTime = 0.f;
+    uint64_t seed = 0;
+    while (in.data != in.end) {
+        ReplayFrame frame;
+        const uint64_t flags = in.fixed(1);
+        deltaTime = (flags & kHasDeltaTime) != 0 ? in.real() : deltaTime;
+        seed = (flags & kHasSeed) != 0 ? in.fixed(8) : FrameLog::nextSeed(seed);
+        frame.deltaTime = deltaTime;
+        frame.seed = seed;
+
+        const uint64_t eventCount = in.varint();
+        bool valid = in.ok && eventCount <= static_cast<uint64_t>(in.end - in.data);
+        if (valid) {
+            frame.events.resize(static_cast<std::size_t>(eventCount));
+            for (sf::Event& event : frame.events) {
+                if (!readEvent(in, event)) {
+                    valid = false;
+                    break;
+                }
+            }
+        }
+        if (!valid) {
+            WARNING("FrameReplay", "load", "log ends with an incomplete frame, replaying the complete ones");
+            break;
+        }
+        m_frames.push_back(std::move(frame));
+    }
+    return true;
+}
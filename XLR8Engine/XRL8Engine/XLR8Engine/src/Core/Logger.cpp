@@ -0,0 +1,193 @@
+#include "Core/Logger.h"
+#include <cstdio>
+#include <iostream>
+
+/**
+ * @file Logger.cpp
+ * @brief Implementation of the asynchronous logger and its writer thread.
+ */
+
+namespace {
+    const std::chrono::milliseconds kDrainInterval(4); ///< Writer sleep between drains.
+
+    const char* const kLevelNames[] = { "TRACE", "DEBUG", "INFO ", "WARN ", "ERROR", "FATAL" };
+
+    /**
+     * @brief Marks the queue closed when its thread exits, so the writer can drop it once
+     * it is empty. Never touches the Logger itself, which may already be gone.
+     */
+    struct
+        ThreadQueueHandle {
+        std::shared_ptr<LogDetail::ThreadQueue> queue;
+
+        ~ThreadQueueHandle() {
+            if (queue) {
+                queue->closed.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ThreadQueueHandle t_queue;
+}
+
+namespace LogDetail {
+
+    /**
+     * @brief Writes "[seconds] LEVEL #thread " and the formatted arguments of each record.
+     */
+    uint32_t
+        ThreadQueue::drain(std::ostream& os) {
+        const uint32_t head = m_head.load(std::memory_order_acquire);
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        const uint32_t count = head - tail;
+
+        char prefix[48];
+        for (; tail != head; ++tail) {
+            Record& record = m_records[tail & (kCapacity - 1)];
+            std::snprintf(prefix, sizeof(prefix), "[%10.4f] %s #%u ",
+                static_cast<double>(record.time) * 1e-9, kLevelNames[record.level], record.thread);
+            os << prefix;
+            record.format(os, record.payload);
+            os << '\n';
+        }
+
+        m_tail.store(tail, std::memory_order_release);
+        return count;
+    }
+}
+
+Logger&
+Logger::get() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger()
+    : m_start(std::chrono::steady_clock::now()) {
+    m_writer = std::thread([this]() { run(); });
+}
+
+/**
+ * @brief Stops the writer after a last drain, so nothing queued before exit is lost.
+ */
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_wake.notify_one();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+}
+
+LogDetail::ThreadQueue&
+Logger::threadQueue() {
+    if (!t_queue.queue) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        t_queue.queue = std::make_shared<LogDetail::ThreadQueue>(m_nextThread++);
+        m_queues.push_back(t_queue.queue);
+    }
+    return *t_queue.queue;
+}
+
+/**
+ * @brief Requests a drain and waits for the writer to finish it.
+ *
+ * Also works after the writer stopped, e.g. from FATAL during shutdown: the calling
+ * thread then drains the queues itself.
+ */
+void
+Logger::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_running) {
+        drainAll();
+        return;
+    }
+
+    const uint64_t request = ++m_flushRequests;
+    m_wake.notify_one();
+    m_flushed.wait(lock, [this, request]() { return m_flushesDone >= request || !m_running; });
+}
+
+bool
+Logger::setOutputFile(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    drainAll();
+    if (path.empty()) {
+        m_file.close();
+        return true;
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    m_file = std::move(file);
+    return true;
+}
+
+LoggerStats
+Logger::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    LoggerStats stats = m_stats;
+    stats.threads = m_queues.size();
+    return stats;
+}
+
+void
+Logger::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running) {
+        const uint64_t request = m_flushRequests;
+        drainAll();
+        if (request != m_flushesDone) {
+            m_flushesDone = request;
+            m_flushed.notify_all();
+        }
+        m_wake.wait_for(lock, kDrainInterval, [this]() {
+            return !m_running || m_flushRequests != m_flushesDone;
+            });
+    }
+
+    drainAll();
+    m_flushesDone = m_flushRequests;
+    m_flushed.notify_all();
+}
+
+/**
+ * @brief Formats every queue into one buffer and writes it with a single call.
+ */
+void
+Logger::drainAll() {
+    m_text.str(std::string());
+    uint64_t written = 0;
+    for (std::size_t i = 0; i < m_queues.size();) {
+        LogDetail::ThreadQueue& queue = *m_queues[i];
+        written += queue.drain(m_text);
+
+        const uint64_t dropped = queue.takeDropped();
+        if (dropped > 0) {
+            m_text << "[logger] " << dropped << " records dropped on thread #" << queue.getThread() << '\n';
+            m_stats.dropped += dropped;
+        }
+
+        // Cola de un hilo terminado: se descarta cuando ya no tiene registros
+        if (queue.closed.load(std::memory_order_acquire) && queue.isEmpty()) {
+            m_queues[i] = m_queues.back();
+            m_queues.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+
+    m_stats.written += written;
+    const std::string text = m_text.str();
+    if (text.empty()) {
+        return;
+    }
+    std::ostream& sink = m_file.is_open() ? static_cast<std::ostream&>(m_file) : std::cerr;
+    sink.write(text.data(), static_cast<std::streamsize>(text.size()));
+    sink.flush();
+}
@@ -0,0 +1,110 @@
+#include "Core/NameTable.h"
+
+/**
+ * @file NameTable.cpp
+ * @brief Implementation of the name interning table.
+ */
+
+namespace {
+    const std::size_t kInitialBuckets = 256; ///< Potencia de dos.
+}
+
+NameTable&
+NameTable::get() {
+    static NameTable table;
+    return table;
+}
+
+NameTable::NameTable()
+    : m_buckets(kInitialBuckets, kNoName) {
+    m_entries.push_back({ std::string(), hashName(std::string()) });
+}
+
+NameId
+NameTable::intern(const std::string& name) {
+    if (name.empty()) {
+        return kNoName;
+    }
+    const uint32_t hash = hashName(name);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::size_t bucket = findBucket(name, hash);
+    if (m_buckets[bucket] != kNoName) {
+        return m_buckets[bucket];
+    }
+
+    // Carga maxima de 1/2 para que las sondas sean cortas
+    if ((m_entries.size() + 1) * 2 > m_buckets.size()) {
+        grow();
+        bucket = findBucket(name, hash);
+    }
+    const NameId id = static_cast<NameId>(m_entries.size());
+    m_entries.push_back({ name, hash });
+    m_buckets[bucket] = id;
+    return id;
+}
+
+NameId
+NameTable::find(const std::string& name) const {
+    if (name.empty()) {
+        return kNoName;
+    }
+    const uint32_t hash = hashName(name);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buckets[findBucket(name, hash)];
+}
+
+const std::string&
+NameTable::getString(NameId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return id < m_entries.size() ? m_entries[id].text : m_entries[kNoName].text;
+}
+
+uint32_t
+NameTable::getHash(NameId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return id < m_entries.size() ? m_entries[id].hash : m_entries[kNoName].hash;
+}
+
+std::size_t
+NameTable::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+uint32_t
+NameTable::hashName(const std::string& name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::size_t
+NameTable::findBucket(const std::string& name, uint32_t hash) const {
+    const std::size_t mask = m_buckets.size() - 1;
+    std::size_t bucket = hash & mask;
+    while (m_buckets[bucket] != kNoName) {
+        const Entry& entry = m_entries[m_buckets[bucket]];
+        if (entry.hash == hash && entry.text == name) {
+            break;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+    return bucket;
+}
+
+void
+NameTable::grow() {
+    std::vector<NameId> buckets(m_buckets.size() * 2, kNoName);
+    const std::size_t mask = buckets.size() - 1;
+    for (NameId id = 1; id < m_entries.size(); ++id) {
+        std::size_t bucket = m_entries[id].hash & mask;
+        while (buckets[bucket] != kNoName) {
+            bucket = (bucket + 1) & mask;
+        }
+        buckets[bucket] = id;
+    }
+    m_buckets.swap(buckets);
+}
@@ -0,0 +1,289 @@
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+/**
+ * @file Profiler.cpp
+ * @brief Implementation of the frame profiler, its aggregation and its exporters.
+ */
+
+namespace {
+    const char* const kFrameZone = "Frame"; ///< Zone added by endFrame() for the whole frame.
+
+    /**
+     * @brief Marks the ring closed when its thread exits, so endFrame() can drop it.
+     */
+    struct
+        ThreadBufferHandle {
+        std::shared_ptr<ProfileDetail::ThreadBuffer> buffer;
+
+        ~ThreadBufferHandle() {
+            if (buffer) {
+                buffer->closed.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ThreadBufferHandle t_buffer;
+
+    /**
+     * @brief Nearest-rank percentile of sorted samples, in milliseconds.
+     */
+    double
+        percentileMs(const std::vector<int64_t>& sorted, double fraction) {
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+        return static_cast<double>(sorted[std::max<std::size_t>(rank, 1) - 1]) * 1e-6;
+    }
+
+    /**
+     * @brief Writes @p text as a JSON string body.
+     */
+    void
+        writeJsonString(std::ostream& os, const char* text) {
+        for (; *text != '\0'; ++text) {
+            const char c = *text;
+            if (c == '"' || c == '\\') {
+                os << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                os << ' ';
+            }
+            else {
+                os << c;
+            }
+        }
+    }
+}
+
+namespace ProfileDetail {
+
+    void
+        ThreadBuffer::drain(std::vector<ProfileEvent>& out) {
+        const uint32_t head = m_head.load(std::memory_order_acquire);
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            out.push_back(m_events[tail & (kCapacity - 1)]);
+        }
+        m_tail.store(tail, std::memory_order_release);
+    }
+}
+
+Profiler&
+Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+    : m_start(std::chrono::steady_clock::now()) {
+}
+
+void
+Profiler::setCapture(bool capture) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capture = capture;
+}
+
+ProfileDetail::ThreadBuffer&
+Profiler::threadBuffer() {
+    if (!t_buffer.buffer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        t_buffer.buffer = std::make_shared<ProfileDetail::ThreadBuffer>(m_nextThread++);
+        m_buffers.push_back(t_buffer.buffer);
+    }
+    return *t_buffer.buffer;
+}
+
+/**
+ * @brief Drains the rings, sums each zone's time for the frame and starts the next frame.
+ *
+ * Zones still open when the frame closes, such as one around the whole main loop, land in
+ * the frame in which they end.
+ */
+void
+Profiler::endFrame() {
+    const int64_t frameEnd = now();
+    if (isEnabled()) {
+        threadBuffer().push(kFrameZone, m_frameStart, frameEnd, 0);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_frameEvents.clear();
+    for (std::size_t i = 0; i < m_buffers.size();) {
+        ProfileDetail::ThreadBuffer& buffer = *m_buffers[i];
+        buffer.drain(m_frameEvents);
+        m_dropped += buffer.takeDropped();
+
+        // Anillo de un hilo terminado: se descarta cuando ya esta vacio
+        if (buffer.closed.load(std::memory_order_acquire) && buffer.isEmpty()) {
+            m_buffers[i] = m_buffers.back();
+            m_buffers.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+
+    for (const ProfileEvent& event : m_frameEvents) {
+        ZoneHistory& zone = m_zones[zoneIndex(event.name)];
+        if (zone.frameCalls == 0) {
+            m_touched.push_back(static_cast<uint32_t>(&zone - m_zones.data()));
+        }
+        zone.frameTotal += event.end - event.start;
+        zone.frameCalls++;
+    }
+
+    for (uint32_t index : m_touched) {
+        ZoneHistory& zone = m_zones[index];
+        if (zone.samples.size() < kHistoryFrames) {
+            zone.samples.push_back(zone.frameTotal);
+            zone.calls.push_back(zone.frameCalls);
+        }
+        else {
+            zone.samples[zone.next] = zone.frameTotal;
+            zone.calls[zone.next] = zone.frameCalls;
+            zone.next = (zone.next + 1) % kHistoryFrames;
+        }
+        zone.frameTotal = 0;
+        zone.frameCalls = 0;
+    }
+    m_touched.clear();
+
+    if (m_capture) {
+        const std::size_t room = kMaxCapturedEvents - m_captured.size();
+        const std::size_t kept = std::min(room, m_frameEvents.size());
+        m_captured.insert(m_captured.end(), m_frameEvents.begin(), m_frameEvents.begin() + kept);
+        m_dropped += m_frameEvents.size() - kept;
+    }
+
+    m_frameStart = frameEnd;
+    m_frameCount++;
+}
+
+uint32_t
+Profiler::zoneIndex(const char* name) {
+    auto cached = m_zoneByPointer.find(name);
+    if (cached != m_zoneByPointer.end()) {
+        return cached->second;
+    }
+
+    auto named = m_zoneByName.find(name);
+    uint32_t index;
+    if (named != m_zoneByName.end()) {
+        index = named->second;
+    }
+    else {
+        index = static_cast<uint32_t>(m_zones.size());
+        m_zones.emplace_back();
+        m_zones.back().name = name;
+        m_zoneByName.emplace(name, index);
+    }
+    m_zoneByPointer.emplace(name, index);
+    return index;
+}
+
+std::vector<ZoneSummary>
+Profiler::summarize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<ZoneSummary> summaries;
+    std::vector<int64_t> sorted;
+
+    for (const ZoneHistory& zone : m_zones) {
+        if (zone.samples.empty()) {
+            continue;
+        }
+
+        sorted = zone.samples;
+        std::sort(sorted.begin(), sorted.end());
+        int64_t total = 0;
+        uint64_t calls = 0;
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            total += sorted[i];
+            calls += zone.calls[i];
+        }
+
+        ZoneSummary summary;
+        summary.name = zone.name;
+        summary.frames = sorted.size();
+        summary.callsPerFrame = static_cast<double>(calls) / sorted.size();
+        summary.meanMs = static_cast<double>(total) * 1e-6 / sorted.size();
+        summary.p50Ms = percentileMs(sorted, 0.50);
+        summary.p90Ms = percentileMs(sorted, 0.90);
+        summary.p99Ms = percentileMs(sorted, 0.99);
+        summary.maxMs = static_cast<double>(sorted.back()) * 1e-6;
+        summaries.push_back(summary);
+    }
+
+    std::sort(summaries.begin(), summaries.end(), [](const ZoneSummary& a, const ZoneSummary& b) {
+        return a.meanMs > b.meanMs;
+        });
+    return summaries;
+}
+
+void
+Profiler::writeSummary(std::ostream& os) const {
+    char line[192];
+    std::snprintf(line, sizeof(line), "%-32s %7s %8s %9s %9s %9s %9s %9s\n",
+        "zone", "frames", "calls", "mean ms", "p50 ms", "p90 ms", "p99 ms", "max ms");
+    os << line;
+    for (const ZoneSummary& zone : summarize()) {
+        std::snprintf(line, sizeof(line), "%-32.32s %7zu %8.1f %9.4f %9.4f %9.4f %9.4f %9.4f\n",
+            zone.name.c_str(), zone.frames, zone.callsPerFrame, zone.meanMs,
+            zone.p50Ms, zone.p90Ms, zone.p99Ms, zone.maxMs);
+        os << line;
+    }
+}
+
+/**
+ * @brief Writes complete ("X") events with microsecond timestamps, plus one thread name
+ * record per thread.
+ */
+bool
+Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    uint32_t threadCount = 0;
+    for (const ProfileEvent& event : m_captured) {
+        threadCount = std::max(threadCount, event.thread + 1);
+    }
+    bool first = true;
+    for (uint32_t thread = 0; thread < threadCount; ++thread) {
+        file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+            << ",\"args\":{\"name\":\"Thread " << thread << "\"}}";
+        first = false;
+    }
+
+    char numbers[96];
+    for (const ProfileEvent& event : m_captured) {
+        file << (first ? "" : ",\n") << "{\"name\":\"";
+        writeJsonString(file, event.name);
+        std::snprintf(numbers, sizeof(numbers), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+            static_cast<double>(event.start) * 1e-3,
+            static_cast<double>(event.end - event.start) * 1e-3, event.thread);
+        file << numbers;
+        first = false;
+    }
+
+    file << "\n]}\n";
+    return file.good();
+}
+
+void
+Profiler::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_captured.clear();
+    for (ZoneHistory& zone : m_zones) {
+        zone.samples.clear();
+        zone.calls.clear();
+        zone.next = 0;
+    }
+    m_dropped = 0;
+}
@@ -0,0 +1,243 @@
+#include "Core/Telemetry.h"
+#include "Core/ThreadPool.h"
+#include "ECS/Entity.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <new>
+
+/**
+ * @file Telemetry.cpp
+ * @brief Implementation of the counters registry, its CSV/JSON Lines stream and the
+ * allocation counter.
+ */
+
+#if XLR8_TRACK_ALLOCATIONS
+namespace {
+    std::atomic<uint64_t> g_allocations{ 0 }; ///< Llamadas a operator new desde el inicio.
+}
+
+/**
+ * @brief Counts the allocation and forwards to malloc. The array and nothrow
+ * forms of operator new are built on this one by the standard library, so they are
+ * counted too.
+ */
+void*
+operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    for (;;) {
+        if (void* block = std::malloc(size != 0 ? size : 1)) {
+            return block;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void
+operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void
+operator delete(void* block, std::size_t) noexcept {
+    std::free(block);
+}
+#endif
+
+namespace {
+    const char* const kBuiltinNames[TELEMETRY_BUILTIN_COUNT] = {
+        "frameMs", "entities", "drawCalls", "vertices", "allocations", "jobQueue"
+    };
+
+    /**
+     * @brief Nearest-rank percentile of sorted frame times.
+     */
+    double
+        percentile(const std::vector<float>& sorted, double fraction) {
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+        return sorted[std::max<std::size_t>(rank, 1) - 1];
+    }
+
+    /**
+     * @brief Writes a counter name as a JSON string body.
+     */
+    void
+        writeJsonString(std::ostream& os, const std::string& text) {
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                os << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                os << ' ';
+            }
+            else {
+                os << c;
+            }
+        }
+    }
+
+    bool
+        endsWith(const std::string& text, const char* suffix) {
+        const std::size_t length = std::char_traits<char>::length(suffix);
+        return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+    }
+}
+
+Telemetry::Telemetry() {
+    for (const char* name : kBuiltinNames) {
+        registerCounter(name);
+    }
+}
+
+Telemetry::~Telemetry() {
+    closeStream();
+}
+
+CounterId
+Telemetry::registerCounter(const std::string& name) {
+    for (std::size_t i = 0; i < m_names.size(); ++i) {
+        if (m_names[i] == name) {
+            return static_cast<CounterId>(i);
+        }
+    }
+    m_names.push_back(name);
+    m_current.push_back(0.0);
+    m_last.push_back(0.0);
+    return static_cast<CounterId>(m_names.size() - 1);
+}
+
+bool
+Telemetry::openStream(const std::string& path) {
+    closeStream();
+    m_stream.open(path, std::ios::out | std::ios::trunc);
+    if (!m_stream.is_open()) {
+        ERROR("Telemetry", "openStream", "Cannot create " + path);
+        return false;
+    }
+    m_streamJson = endsWith(path, ".json") || endsWith(path, ".jsonl");
+    m_streamColumns = 0;
+    return true;
+}
+
+void
+Telemetry::closeStream() {
+    if (m_stream.is_open()) {
+        m_stream.close();
+    }
+}
+
+/**
+ * @brief The first active call only starts the clock, since there is no previous frame
+ * to measure against; an inactive call stops it again.
+ */
+void
+Telemetry::endFrame(const RenderStats& renderStats) {
+    if (!isActive()) {
+        m_hasFrameStart = false;
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const uint64_t allocations = getAllocationCount();
+    if (!m_hasFrameStart) {
+        m_frameStart = now;
+        m_allocationsAtFrameStart = allocations;
+        m_hasFrameStart = true;
+        return;
+    }
+
+    const double frameMs = std::chrono::duration<double, std::milli>(now - m_frameStart).count();
+    m_current[TELEMETRY_FRAME_MS] = frameMs;
+    m_current[TELEMETRY_ENTITIES] = static_cast<double>(Entity::getLiveCount());
+    m_current[TELEMETRY_DRAW_CALLS] = static_cast<double>(renderStats.drawCalls);
+    m_current[TELEMETRY_VERTICES] = static_cast<double>(renderStats.vertices);
+    m_current[TELEMETRY_ALLOCATIONS] = static_cast<double>(allocations - m_allocationsAtFrameStart);
+    m_current[TELEMETRY_JOB_QUEUE] = static_cast<double>(ThreadPool::getPendingTaskCount());
+
+    m_frameTimes[m_frameCount % kHistory] = static_cast<float>(frameMs);
+    m_historyCount = std::min(m_historyCount + 1, kHistory);
+    m_frameCount++;
+
+    m_last.swap(m_current);
+    std::fill(m_current.begin(), m_current.end(), 0.0);
+
+    if (m_stream.is_open()) {
+        writeStreamRow();
+    }
+
+    // Las reservas del stream no cuentan para el frame siguiente
+    m_frameStart = now;
+    m_allocationsAtFrameStart = getAllocationCount();
+}
+
+FrameTimeStats
+Telemetry::getFrameTimes() const {
+    FrameTimeStats stats;
+    if (m_historyCount == 0) {
+        return stats;
+    }
+    std::vector<float> sorted(m_frameTimes.begin(), m_frameTimes.begin() + m_historyCount);
+    std::sort(sorted.begin(), sorted.end());
+    stats.p50 = percentile(sorted, 0.50);
+    stats.p90 = percentile(sorted, 0.90);
+    stats.p99 = percentile(sorted, 0.99);
+    stats.max = sorted.back();
+    stats.frames = sorted.size();
+    return stats;
+}
+
+uint64_t
+Telemetry::getAllocationCount() {
+#if XLR8_TRACK_ALLOCATIONS
+    return g_allocations.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief CSV rows carry the counters known when the header was written; JSON objects
+ * carry every counter. Both end with the running frame time percentiles.
+ */
+void
+Telemetry::writeStreamRow() {
+    const FrameTimeStats times = getFrameTimes();
+    char number[32];
+
+    if (m_streamJson) {
+        m_stream << "{\"frame\":" << m_frameCount;
+        for (std::size_t i = 0; i < m_names.size(); ++i) {
+            m_stream << ",\"";
+            writeJsonString(m_stream, m_names[i]);
+            std::snprintf(number, sizeof(number), "\":%.6g", m_last[i]);
+            m_stream << number;
+        }
+        std::snprintf(number, sizeof(number), "%.4f", times.p50);
+        m_stream << ",\"frameMsP50\":" << number;
+        std::snprintf(number, sizeof(number), "%.4f", times.p90);
+        m_stream << ",\"frameMsP90\":" << number;
+        std::snprintf(number, sizeof(number), "%.4f", times.p99);
+        m_stream << ",\"frameMsP99\":" << number << "}\n";
+        return;
+    }
+
+    if (m_streamColumns == 0) {
+        m_streamColumns = m_names.size();
+        m_stream << "frame";
+        for (std::size_t i = 0; i < m_streamColumns; ++i) {
+            m_stream << ',' << m_names[i];
+        }
+        m_stream << ",frameMsP50,frameMsP90,frameMsP99\n";
+    }
+    m_stream << m_frameCount;
+    for (std::size_t i = 0; i < m_streamColumns; ++i) {
+        std::snprintf(number, sizeof(number), ",%.6g", m_last[i]);
+        m_stream << number;
+    }
+    std::snprintf(number, sizeof(number), ",%.4f,%.4f,%.4f\n", times.p50, times.p90, times.p99);
+    m_stream << number;
+}
@@ -0,0 +1,159 @@
+#include "Core/ThreadPool.h"
+#include <algorithm>
+
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the worker thread pool.
+ */
+
+namespace {
+    std::atomic<std::size_t> g_pendingTasks{ 0 }; ///< Tareas en cola de todos los pools.
+
+    /**
+     * @struct ParallelForState
+     * @brief Chunk counters shared by the threads of one parallelFor() call.
+     *
+     * Helper tasks hold it through a shared pointer, so a helper that starts after the
+     * loop finished only touches this state and never the caller's stack.
+     */
+    struct
+        ParallelForState {
+        std::atomic<std::size_t> nextChunk{ 0 };
+        std::atomic<std::size_t> doneChunks{ 0 };
+        std::size_t chunkCount = 0;
+        std::size_t chunkSize = 0;
+        std::size_t count = 0;
+        const std::function<void(std::size_t, std::size_t)>* body = nullptr;
+        std::mutex mutex;
+        std::condition_variable finished;
+
+        /**
+         * @brief Runs chunks until none are left.
+         */
+        void
+            run() {
+            for (;;) {
+                const std::size_t chunk = nextChunk.fetch_add(1);
+                if (chunk >= chunkCount) {
+                    return;
+                }
+                const std::size_t begin = chunk * chunkSize;
+                (*body)(begin, std::min(begin + chunkSize, count));
+                if (doneChunks.fetch_add(1) + 1 == chunkCount) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished.notify_all();
+                }
+            }
+        }
+    };
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    if (threadCount == 0) {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        threadCount = hardware > 1 ? hardware - 1 : 0;
+    }
+    m_workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_taskReady.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void
+ThreadPool::enqueue(std::function<void()> task) {
+    if (m_workers.empty()) {
+        task();
+        return;
+    }
+    {
+        // Contar antes de publicar: un hilo puede sacar la tarea en cuanto se suelte el lock
+        std::lock_guard<std::mutex> lock(m_mutex);
+        g_pendingTasks.fetch_add(1, std::memory_order_relaxed);
+        m_tasks.push_back(std::move(task));
+    }
+    m_taskReady.notify_one();
+}
+
+/**
+ * @brief Splits the range into about four chunks per thread and works on it alongside
+ * the helpers it queued.
+ */
+void
+ThreadPool::parallelFor(std::size_t count, std::size_t grainSize,
+    const std::function<void(std::size_t, std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    const std::size_t threads = getThreadCount();
+    const std::size_t chunkSize = std::max<std::size_t>(std::max<std::size_t>(grainSize, 1),
+        (count + threads * 4 - 1) / (threads * 4));
+    const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount == 1 || m_workers.empty()) {
+        body(0, count);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->chunkCount = chunkCount;
+    state->chunkSize = chunkSize;
+    state->count = count;
+    state->body = &body;
+
+    const std::size_t helpers = std::min(m_workers.size(), chunkCount - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue([state]() { state->run(); });
+    }
+    state->run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&state]() { return state->doneChunks.load() == state->chunkCount; });
+}
+
+void
+ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_tasks.empty() && m_active == 0; });
+}
+
+std::size_t
+ThreadPool::getPendingTaskCount() {
+    return g_pendingTasks.load(std::memory_order_relaxed);
+}
+
+void
+ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskReady.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_tasks.empty()) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_active++;
+        }
+        g_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_active--;
+        }
+        m_idle.notify_all();
+    }
+}
@@ -2,32 +2,57 @@
 #include "../../include/Memory/TWeakPointer.h"
 #include "../../include/CShape.h"
 
-Actor::Actor(const std::string& actorName) {
-	//Setup Actor Name
-	m_name = actorName;
+Actor::Actor(const std::string& actorName) : m_name(NameTable::get().intern(actorName)) {
+	//Setup Shape
+	EngineUtilities::TSharedPointer<CShape> shape = EngineUtilities::MakeShared<CShape>();
+	addComponent(shape);
 
 	//Setup Transform
-	EngineUtilities::TSharedPointer<CShape> shape = EngineUtilities::MakeShared<CShape>();
+	addComponent(EngineUtilities::MakeShared<Transform>());
 }
 
 void Actor::start()
 {
+	for (Component* component : hookComponents[HOOK_START]) {
+		component->start();
+	}
 }
 
-
-
-
-
 void Actor::update(float deltaTime)
 {
+	for (Component* component : hookComponents[HOOK_UPDATE]) {
+		component->update(deltaTime);
+	}
 }
 
 void
 Actor::render(const EngineUtilities::TSharedPointer<Window>& window) {
+	for (Component* component : hookComponents[HOOK_RENDER]) {
+		component->render(window);
+	}
+}
 
-
+void
+Actor::bindTransform(TransformSync& sync) {
+	auto transform = getComponent<Transform>();
+	if (!transform) {
+		return;
+	}
+
+	if (auto shape = getComponent<CShape>()) {
+		sync.bind(*transform, shape->getRenderTransform());
+	}
+	else if (auto sprite = getComponent<CSprite>()) {
+		sync.bind(*transform, sprite->getRenderTransform());
+	}
+	else if (auto emitter = getComponent<CParticleEmitter>()) {
+		sync.bind(*transform, emitter->getRenderTransform());
+	}
 }
 
 void Actor::destroy()
 {
-}
\ No newline at end of file
+	for (Component* component : hookComponents[HOOK_DESTROY]) {
+		component->destroy();
+	}
+}
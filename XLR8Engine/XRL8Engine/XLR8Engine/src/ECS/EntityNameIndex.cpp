@@ -0,0 +1,112 @@
+#include "ECS/EntityNameIndex.h"
+
+/**
+ * @file EntityNameIndex.cpp
+ * @brief Implementation of the entity name index.
+ */
+
+namespace {
+    const std::size_t kInitialBuckets = 64; ///< Potencia de dos.
+}
+
+bool
+EntityNameIndex::add(NameId name, Entity* entity) {
+    if (name == NameTable::kNoName) {
+        return false;
+    }
+    // Carga maxima de 1/2 para que las sondas sean cortas
+    if ((m_count + 1) * 2 > m_buckets.size()) {
+        grow();
+    }
+    const std::size_t mask = m_buckets.size() - 1;
+    std::size_t bucket = home(name);
+    while (m_buckets[bucket].name != NameTable::kNoName) {
+        if (m_buckets[bucket].name == name) {
+            return false;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+    m_buckets[bucket].name = name;
+    m_buckets[bucket].entity = entity;
+    m_count++;
+    return true;
+}
+
+/**
+ * @brief Backward-shift deletion: the entries after the removed one move back into the
+ * gap when their probe passes through it, so the table needs no tombstones.
+ */
+void
+EntityNameIndex::remove(NameId name) {
+    if (m_count == 0 || name == NameTable::kNoName) {
+        return;
+    }
+    const std::size_t mask = m_buckets.size() - 1;
+    std::size_t bucket = home(name);
+    while (m_buckets[bucket].name != name) {
+        if (m_buckets[bucket].name == NameTable::kNoName) {
+            return;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+
+    std::size_t gap = bucket;
+    std::size_t next = (gap + 1) & mask;
+    while (m_buckets[next].name != NameTable::kNoName) {
+        // Solo se mueve si su sonda empieza fuera de (gap, next]
+        const std::size_t start = home(m_buckets[next].name);
+        if (((next - start) & mask) >= ((next - gap) & mask)) {
+            m_buckets[gap] = m_buckets[next];
+            gap = next;
+        }
+        next = (next + 1) & mask;
+    }
+    m_buckets[gap] = Bucket();
+    m_count--;
+}
+
+Entity*
+EntityNameIndex::find(NameId name) const {
+    if (m_count == 0 || name == NameTable::kNoName) {
+        return nullptr;
+    }
+    const std::size_t mask = m_buckets.size() - 1;
+    std::size_t bucket = home(name);
+    while (m_buckets[bucket].name != NameTable::kNoName) {
+        if (m_buckets[bucket].name == name) {
+            return m_buckets[bucket].entity;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+    return nullptr;
+}
+
+void
+EntityNameIndex::clear() {
+    m_buckets.clear();
+    m_count = 0;
+}
+
+std::size_t
+EntityNameIndex::home(NameId name) const {
+    // Hash de Fibonacci: los IDs son consecutivos y se reparten por toda la tabla
+    return static_cast<std::size_t>((name * 2654435769u) >> 8) & (m_buckets.size() - 1);
+}
+
+void
+EntityNameIndex::grow() {
+    std::vector<Bucket> old;
+    old.swap(m_buckets);
+    m_buckets.resize(old.empty() ? kInitialBuckets : old.size() * 2);
+    const std::size_t mask = m_buckets.size() - 1;
+    for (const Bucket& entry : old) {
+        if (entry.name == NameTable::kNoName) {
+            continue;
+        }
+        std::size_t bucket = home(entry.name);
+        while (m_buckets[bucket].name != NameTable::kNoName) {
+            bucket = (bucket + 1) & mask;
+        }
+        m_buckets[bucket] = entry;
+    }
+}
@@ -0,0 +1,72 @@
+#include "ECS/TransformSync.h"
+#include "ECS/Transform.h"
+#include "Math/ConstMath.h"
+#include "Math/VectorMath.h"
+#include <algorithm>
+
+/**
+ * @file TransformSync.cpp
+ * @brief Implementation of the dirty-tracked Transform to render data synchronization.
+ */
+
+/**
+ * @brief Binds a transform to its render target and marks it dirty so the target is
+ * initialized on the next flush.
+ */
+void
+TransformSync::bind(Transform& transform, sf::Transform& target) {
+    if (transform.m_sync != nullptr && transform.m_sync != this) {
+        transform.m_sync->unbind(transform);
+    }
+
+    transform.m_target = &target;
+    if (transform.m_sync != this) {
+        transform.m_sync = this;
+        transform.m_dirty = false;
+    }
+    transform.markDirty();
+}
+
+/**
+ * @brief Detaches a transform from this stage.
+ */
+void
+TransformSync::unbind(Transform& transform) {
+    if (transform.m_sync != this) {
+        return;
+    }
+
+    if (transform.m_dirty) {
+        m_dirty.erase(std::remove(m_dirty.begin(), m_dirty.end(), &transform), m_dirty.end());
+    }
+    transform.m_sync = nullptr;
+    transform.m_target = nullptr;
+    transform.m_dirty = false;
+}
+
+/**
+ * @brief Writes position, rotation and scale of every dirty transform into its target.
+ *
+ * The rotations are gathered first so their sines and cosines come from one SIMD batch.
+ */
+void
+TransformSync::flush() {
+    XLR8_PROFILE_SCOPE("TransformSync::flush");
+    const std::size_t count = m_dirty.size();
+    m_angles.resize(count);
+    m_sines.resize(count);
+    m_cosines.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        m_angles[i] = VectorMath::wrapDegrees(m_dirty[i]->m_rotation) * ConstMath::DEG_TO_RAD;
+    }
+    VectorMath::sinCos(m_angles.data(), m_sines.data(), m_cosines.data(), count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        Transform* transform = m_dirty[i];
+        *transform->m_target = VectorMath::composeTransform(transform->m_position,
+            m_sines[i], m_cosines[i], transform->m_scale);
+        transform->m_dirty = false;
+    }
+    m_dirty.clear();
+}
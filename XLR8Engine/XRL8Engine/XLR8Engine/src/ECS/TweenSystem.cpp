@@ -0,0 +1,328 @@
+#include "ECS/TweenSystem.h"
+#include "ECS/Transform.h"
+#include "CShape.h"
+#include <algorithm>
+
+/**
+ * @file TweenSystem.cpp
+ * @brief Implementation of the batched tween system.
+ */
+
+namespace {
+    const std::size_t kComponents[TWEEN_PROPERTY_COUNT] = { 2, 1, 2, 4 }; ///< Floats per property.
+    const float kMinDuration = 1e-6f;  ///< Keeps the inverse duration finite.
+
+    uint8_t
+        toChannel(float value) {
+        return static_cast<uint8_t>(std::min(std::max(value, 0.f), 255.f) + 0.5f);
+    }
+}
+
+TweenId
+TweenSystem::tweenPosition(Transform& target, const sf::Vector2f& to, float duration,
+    EaseType ease, float delay) {
+    const float end[] = { to.x, to.y };
+    return add(TWEEN_POSITION, &target, end, duration, ease, delay);
+}
+
+TweenId
+TweenSystem::tweenRotation(Transform& target, float to, float duration,
+    EaseType ease, float delay) {
+    return add(TWEEN_ROTATION, &target, &to, duration, ease, delay);
+}
+
+TweenId
+TweenSystem::tweenScale(Transform& target, const sf::Vector2f& to, float duration,
+    EaseType ease, float delay) {
+    const float end[] = { to.x, to.y };
+    return add(TWEEN_SCALE, &target, end, duration, ease, delay);
+}
+
+TweenId
+TweenSystem::tweenColor(CShape& target, const sf::Color& to, float duration,
+    EaseType ease, float delay) {
+    const float end[] = { static_cast<float>(to.r), static_cast<float>(to.g),
+        static_cast<float>(to.b), static_cast<float>(to.a) };
+    return add(TWEEN_COLOR, &target, end, duration, ease, delay);
+}
+
+TweenId
+TweenSystem::add(TweenProperty property, void* target, const float* to,
+    float duration, EaseType ease, float delay) {
+    if (ease < EASE_LINEAR || ease >= EASE_COUNT) {
+        ERROR("TweenSystem", "add", "Unknown easing curve, using linear");
+        ease = EASE_LINEAR;
+    }
+
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        slot = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    const uint32_t bucketIndex = static_cast<uint32_t>(property) * EASE_COUNT + ease;
+    Bucket& bucket = m_buckets[bucketIndex];
+    m_slots[slot].used = true;
+    m_slots[slot].bucket = bucketIndex;
+    m_slots[slot].index = static_cast<uint32_t>(bucket.targets.size());
+
+    // Un tween con retardo lee su inicio al empezar, no al crearse
+    float from[kMaxComponents];
+    read(property, target, from);
+    const bool delayed = delay > 0.f;
+
+    bucket.elapsed.push_back(-std::max(delay, 0.f));
+    bucket.inverseDuration.push_back(1.f / std::max(duration, kMinDuration));
+    bucket.progress.push_back(0.f);
+    for (std::size_t c = 0; c < kComponents[property]; ++c) {
+        bucket.from[c].push_back(from[c]);
+        bucket.to[c].push_back(to[c]);
+        bucket.value[c].push_back(from[c]);
+    }
+    bucket.targets.push_back(target);
+    bucket.slots.push_back(slot);
+    bucket.delayed.push_back(delayed ? 1 : 0);
+    bucket.delayedCount += delayed ? 1 : 0;
+    m_activeCount++;
+
+    return (static_cast<uint64_t>(m_slots[slot].generation) << 32) | slot;
+}
+
+void
+TweenSystem::stop(TweenId id) {
+    if (!isActive(id)) {
+        return;
+    }
+    const Slot& slot = m_slots[static_cast<uint32_t>(id)];
+    removeAt(slot.bucket, slot.index);
+}
+
+void
+TweenSystem::stopTarget(const void* target) {
+    for (uint32_t b = 0; b < m_buckets.size(); ++b) {
+        std::vector<void*>& targets = m_buckets[b].targets;
+        for (std::size_t i = targets.size(); i-- > 0;) {
+            if (targets[i] == target) {
+                removeAt(b, i);
+            }
+        }
+    }
+}
+
+bool
+TweenSystem::isActive(TweenId id) const {
+    const uint32_t index = static_cast<uint32_t>(id);
+    return index < m_slots.size() && m_slots[index].used &&
+        m_slots[index].generation == static_cast<uint32_t>(id >> 32);
+}
+
+/**
+ * @brief Each bucket is one pass of SIMD kernels over its arrays: advance the timers,
+ * ease the progress, interpolate every component. Only the write into the targets and
+ * the end-of-tween check are per-tween scalar loops.
+ */
+void
+TweenSystem::update(float deltaTime) {
+    XLR8_PROFILE_SCOPE("TweenSystem::update");
+    for (uint32_t b = 0; b < m_buckets.size(); ++b) {
+        Bucket& bucket = m_buckets[b];
+        const std::size_t count = bucket.targets.size();
+        if (count == 0) {
+            continue;
+        }
+        const TweenProperty property = static_cast<TweenProperty>(b / EASE_COUNT);
+        const EaseType ease = static_cast<EaseType>(b % EASE_COUNT);
+
+        VectorMath::advanceProgress(bucket.elapsed.data(), bucket.inverseDuration.data(), deltaTime,
+            bucket.progress.data(), count);
+        if (bucket.delayedCount > 0) {
+            startDelayed(property, bucket, count);
+        }
+        VectorMath::ease(ease, bucket.progress.data(), bucket.progress.data(), count);
+        for (std::size_t c = 0; c < kComponents[property]; ++c) {
+            VectorMath::lerp(bucket.from[c].data(), bucket.to[c].data(), bucket.progress.data(),
+                bucket.value[c].data(), count);
+        }
+
+        // El ultimo paso deja el valor final exacto, sin el error de la curva
+        for (std::size_t i = 0; i < count; ++i) {
+            if (bucket.elapsed[i] * bucket.inverseDuration[i] >= 1.f) {
+                for (std::size_t c = 0; c < kComponents[property]; ++c) {
+                    bucket.value[c][i] = bucket.to[c][i];
+                }
+            }
+        }
+
+        write(property, bucket, count);
+
+        // Al reves para que el swap-remove no salte tweens
+        for (std::size_t i = count; i-- > 0;) {
+            if (bucket.elapsed[i] * bucket.inverseDuration[i] >= 1.f) {
+                removeAt(b, i);
+            }
+        }
+    }
+}
+
+void
+TweenSystem::clear() {
+    for (Bucket& bucket : m_buckets) {
+        for (uint32_t slot : bucket.slots) {
+            m_slots[slot].used = false;
+            m_slots[slot].generation++;
+            m_freeSlots.push_back(slot);
+        }
+        bucket.elapsed.clear();
+        bucket.inverseDuration.clear();
+        bucket.progress.clear();
+        for (std::size_t c = 0; c < kMaxComponents; ++c) {
+            bucket.from[c].clear();
+            bucket.to[c].clear();
+            bucket.value[c].clear();
+        }
+        bucket.targets.clear();
+        bucket.slots.clear();
+        bucket.delayed.clear();
+        bucket.delayedCount = 0;
+    }
+    m_activeCount = 0;
+}
+
+void
+TweenSystem::read(TweenProperty property, const void* target, float* out) {
+    switch (property) {
+    case TWEEN_POSITION: {
+        const sf::Vector2f position = static_cast<const Transform*>(target)->getPosition();
+        out[0] = position.x;
+        out[1] = position.y;
+        break;
+    }
+    case TWEEN_ROTATION:
+        out[0] = static_cast<const Transform*>(target)->getRotation();
+        break;
+    case TWEEN_SCALE: {
+        const sf::Vector2f scale = static_cast<const Transform*>(target)->getScale();
+        out[0] = scale.x;
+        out[1] = scale.y;
+        break;
+    }
+    case TWEEN_COLOR: {
+        const sf::Color color = static_cast<const CShape*>(target)->getFillColor();
+        out[0] = static_cast<float>(color.r);
+        out[1] = static_cast<float>(color.g);
+        out[2] = static_cast<float>(color.b);
+        out[3] = static_cast<float>(color.a);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Runs only while a bucket has delayed tweens. The target is read before this
+ * update writes anything, so a tween chained after another starts from the value the
+ * previous update left.
+ */
+void
+TweenSystem::startDelayed(TweenProperty property, Bucket& bucket, std::size_t count) {
+    float from[kMaxComponents];
+    for (std::size_t i = 0; i < count; ++i) {
+        if (bucket.delayed[i] == 0 || bucket.elapsed[i] < 0.f) {
+            continue;
+        }
+        read(property, bucket.targets[i], from);
+        for (std::size_t c = 0; c < kComponents[property]; ++c) {
+            bucket.from[c][i] = from[c];
+        }
+        bucket.delayed[i] = 0;
+        bucket.delayedCount--;
+    }
+}
+
+/**
+ * @brief Tweens still in their delay are skipped, so they do not override other tweens
+ * of the same target.
+ */
+void
+TweenSystem::write(TweenProperty property, Bucket& bucket, std::size_t count) {
+    void* const* targets = bucket.targets.data();
+    const uint8_t* delayed = bucket.delayed.data();
+    const float* x = bucket.value[0].data();
+    const float* y = bucket.value[1].data();
+    switch (property) {
+    case TWEEN_POSITION:
+        for (std::size_t i = 0; i < count; ++i) {
+            if (delayed[i] == 0) {
+                static_cast<Transform*>(targets[i])->setPosition(sf::Vector2f(x[i], y[i]));
+            }
+        }
+        break;
+    case TWEEN_ROTATION:
+        for (std::size_t i = 0; i < count; ++i) {
+            if (delayed[i] == 0) {
+                static_cast<Transform*>(targets[i])->setRotation(x[i]);
+            }
+        }
+        break;
+    case TWEEN_SCALE:
+        for (std::size_t i = 0; i < count; ++i) {
+            if (delayed[i] == 0) {
+                static_cast<Transform*>(targets[i])->setScale(sf::Vector2f(x[i], y[i]));
+            }
+        }
+        break;
+    case TWEEN_COLOR: {
+        const float* b = bucket.value[2].data();
+        const float* a = bucket.value[3].data();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (delayed[i] == 0) {
+                static_cast<CShape*>(targets[i])->setFillColor(
+                    sf::Color(toChannel(x[i]), toChannel(y[i]), toChannel(b[i]), toChannel(a[i])));
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void
+TweenSystem::removeAt(uint32_t bucketIndex, std::size_t index) {
+    Bucket& bucket = m_buckets[bucketIndex];
+    const std::size_t last = bucket.targets.size() - 1;
+    const uint32_t removedSlot = bucket.slots[index];
+
+    auto swapRemove = [index, last](EngineUtilities::TAlignedArray<float>& values) {
+        values[index] = values[last];
+        values.pop_back();
+    };
+    swapRemove(bucket.elapsed);
+    swapRemove(bucket.inverseDuration);
+    swapRemove(bucket.progress);
+    for (std::size_t c = 0; c < kComponents[bucketIndex / EASE_COUNT]; ++c) {
+        swapRemove(bucket.from[c]);
+        swapRemove(bucket.to[c]);
+        swapRemove(bucket.value[c]);
+    }
+    bucket.delayedCount -= bucket.delayed[index];
+    bucket.delayed[index] = bucket.delayed[last];
+    bucket.delayed.pop_back();
+    bucket.targets[index] = bucket.targets[last];
+    bucket.targets.pop_back();
+    bucket.slots[index] = bucket.slots[last];
+    bucket.slots.pop_back();
+    if (index != last) {
+        m_slots[bucket.slots[index]].index = static_cast<uint32_t>(index);
+    }
+
+    m_slots[removedSlot].used = false;
+    m_slots[removedSlot].generation++;
+    m_freeSlots.push_back(removedSlot);
+    m_activeCount--;
+}
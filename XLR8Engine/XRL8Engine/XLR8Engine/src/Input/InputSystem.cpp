@@ -0,0 +1,170 @@
+#include "Input/InputSystem.h"
+
+/**
+ * @file InputSystem.cpp
+ * @brief Implementation of the buffered input system.
+ */
+
+ActionId
+InputSystem::getActionId(const std::string& name) {
+    auto it = m_actionIds.find(name);
+    if (it != m_actionIds.end()) {
+        return it->second;
+    }
+
+    const ActionId id = static_cast<ActionId>(m_actionIds.size());
+    if (id >= InputSnapshot::kMaxActions) {
+        ERROR("InputSystem", "getActionId", "Too many input actions");
+        return InputSnapshot::kInvalidAction;
+    }
+    m_actionIds.emplace(name, id);
+    return id;
+}
+
+ActionId
+InputSystem::bindAction(const std::string& name, sf::Keyboard::Key key) {
+    const ActionId id = getActionId(name);
+    if (id != InputSnapshot::kInvalidAction) {
+        m_bindings.push_back({ id, true, static_cast<int>(key) });
+    }
+    return id;
+}
+
+ActionId
+InputSystem::bindAction(const std::string& name, sf::Mouse::Button button) {
+    const ActionId id = getActionId(name);
+    if (id != InputSnapshot::kInvalidAction) {
+        m_bindings.push_back({ id, false, static_cast<int>(button) });
+    }
+    return id;
+}
+
+/**
+ * @brief Releases the previous frame's events and clears the per-frame edges.
+ */
+void
+InputSystem::beginFrame() {
+    m_eventHead = (m_eventHead + m_eventCount) % kEventCapacity;
+    m_eventCount = 0;
+
+    m_snapshot.keysPressed.reset();
+    m_snapshot.keysReleased.reset();
+    m_snapshot.buttonsPressed.reset();
+    m_snapshot.buttonsReleased.reset();
+    m_snapshot.wheelDelta = 0.f;
+}
+
+/**
+ * @brief Appends an event to the ring buffer.
+ */
+void
+InputSystem::pushEvent(const sf::Event& event) {
+    if (m_eventCount == kEventCapacity) {
+        m_droppedEvents++;
+        return;
+    }
+    m_events[(m_eventHead + m_eventCount) % kEventCapacity] = event;
+    m_eventCount++;
+}
+
+/**
+ * @brief Drains the buffered events into the bitsets and evaluates every action binding.
+ *
+ * Besides the change of actionsDown, an action is pressed when any of its keys or
+ * buttons went down this frame, and released when one went up and the action is no
+ * longer held. A tap pressed and released within one frame, common at low frame rates
+ * and in replays, still reports both edges.
+ */
+void
+InputSystem::endFrame() {
+    for (std::size_t i = 0; i < m_eventCount; ++i) {
+        applyEvent(getEvent(i));
+    }
+
+    const std::bitset<InputSnapshot::kMaxActions> previousActions = m_snapshot.actionsDown;
+    std::bitset<InputSnapshot::kMaxActions> pressedBindings;
+    std::bitset<InputSnapshot::kMaxActions> releasedBindings;
+    m_snapshot.actionsDown.reset();
+    for (const ActionBinding& binding : m_bindings) {
+        const bool down = binding.isKey
+            ? m_snapshot.keysDown[binding.code]
+            : m_snapshot.buttonsDown[binding.code];
+        const bool pressed = binding.isKey
+            ? m_snapshot.keysPressed[binding.code]
+            : m_snapshot.buttonsPressed[binding.code];
+        const bool released = binding.isKey
+            ? m_snapshot.keysReleased[binding.code]
+            : m_snapshot.buttonsReleased[binding.code];
+        if (down) {
+            m_snapshot.actionsDown.set(binding.action);
+        }
+        if (pressed) {
+            pressedBindings.set(binding.action);
+        }
+        if (released) {
+            releasedBindings.set(binding.action);
+        }
+    }
+    m_snapshot.actionsPressed = (m_snapshot.actionsDown & ~previousActions) | pressedBindings;
+    m_snapshot.actionsReleased = (previousActions | releasedBindings) & ~m_snapshot.actionsDown;
+    m_snapshot.frame++;
+}
+
+/**
+ * @brief Updates the key and mouse state for one event.
+ *
+ * Losing focus releases every key and button so nothing stays stuck down.
+ */
+void
+InputSystem::applyEvent(const sf::Event& event) {
+    switch (event.type) {
+    case sf::Event::KeyPressed:
+        if (event.key.code >= 0 && event.key.code < sf::Keyboard::KeyCount) {
+            if (!m_snapshot.keysDown[event.key.code]) {
+                m_snapshot.keysPressed.set(event.key.code);
+            }
+            m_snapshot.keysDown.set(event.key.code);
+        }
+        break;
+    case sf::Event::KeyReleased:
+        if (event.key.code >= 0 && event.key.code < sf::Keyboard::KeyCount) {
+            m_snapshot.keysDown.reset(event.key.code);
+            m_snapshot.keysReleased.set(event.key.code);
+        }
+        break;
+    case sf::Event::MouseButtonPressed:
+        if (event.mouseButton.button < sf::Mouse::ButtonCount) {
+            m_snapshot.buttonsDown.set(event.mouseButton.button);
+            m_snapshot.buttonsPressed.set(event.mouseButton.button);
+        }
+        m_snapshot.mousePosition = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        break;
+    case sf::Event::MouseButtonReleased:
+        if (event.mouseButton.button < sf::Mouse::ButtonCount) {
+            m_snapshot.buttonsDown.reset(event.mouseButton.button);
+            m_snapshot.buttonsReleased.set(event.mouseButton.button);
+        }
+        m_snapshot.mousePosition = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        break;
+    case sf::Event::MouseMoved:
+        m_snapshot.mousePosition = sf::Vector2i(event.mouseMove.x, event.mouseMove.y);
+        break;
+    case sf::Event::MouseWheelScrolled:
+        if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+            m_snapshot.wheelDelta += event.mouseWheelScroll.delta;
+        }
+        break;
+    case sf::Event::LostFocus:
+        m_snapshot.focused = false;
+        m_snapshot.keysReleased |= m_snapshot.keysDown;
+        m_snapshot.buttonsReleased |= m_snapshot.buttonsDown;
+        m_snapshot.keysDown.reset();
+        m_snapshot.buttonsDown.reset();
+        break;
+    case sf::Event::GainedFocus:
+        m_snapshot.focused = true;
+        break;
+    default:
+        break;
+    }
+}
@@ -1,19 +1,170 @@
 #include "BaseApp.h"
+#include "Server/SimulationServer.h"
+#include <cstdlib>
+#include <cstring>
 
 /**
  * @file main.cpp
  * @brief Entry point of the application.
  */
 
+namespace {
+	const std::size_t kServerBodies = 1024; ///< Cuerpos de cada mundo de la demo de servidor.
+
+	/**
+	 * @brief Body of the server demo, trivially destructible so it lives in the world's arena.
+	 */
+	struct ServerBody {
+		float x = 0.f;
+		float y = 0.f;
+		float vx = 0.f;
+		float vy = 0.f;
+	};
+
+	/**
+	 * @brief Runs @p worldCount demo sessions without a window and prints the step counts.
+	 *
+	 * Each world bounces its bodies inside an 800x600 box; even worlds step at 60 Hz and
+	 * odd ones at 30 Hz.
+	 */
+	int
+	runServer(std::size_t worldCount, double seconds) {
+		SimulationServer server;
+		std::vector<WorldId> worlds;
+		for (std::size_t i = 0; i < worldCount; ++i) {
+			WorldSettings settings;
+			settings.name = "World " + std::to_string(i);
+			settings.stepRate = i % 2 == 0 ? 60.f : 30.f;
+			worlds.push_back(server.addWorld(settings));
+
+			World* world = server.getWorld(worlds.back());
+			ServerBody* bodies = world->getArena().createArray<ServerBody>(kServerBodies);
+			uint32_t seed = static_cast<uint32_t>(i) * 2654435761u + 1u;
+			for (std::size_t b = 0; b < kServerBodies; ++b) {
+				seed = seed * 1664525u + 1013904223u;
+				bodies[b].x = static_cast<float>(seed % 800u);
+				bodies[b].y = static_cast<float>((seed >> 10) % 600u);
+				bodies[b].vx = static_cast<float>(seed >> 24) - 128.f;
+				bodies[b].vy = static_cast<float>((seed >> 16) & 0xFFu) - 128.f;
+			}
+			world->setStepCallback([bodies](World&, float deltaTime) {
+				for (std::size_t b = 0; b < kServerBodies; ++b) {
+					ServerBody& body = bodies[b];
+					body.x += body.vx * deltaTime;
+					body.y += body.vy * deltaTime;
+					if (body.x < 0.f || body.x > 800.f) body.vx = -body.vx;
+					if (body.y < 0.f || body.y > 600.f) body.vy = -body.vy;
+				}
+			});
+		}
+
+		server.run(seconds);
+
+		uint64_t dropped = 0;
+		for (WorldId id : worlds) {
+			dropped += server.getWorld(id)->getDroppedSteps();
+		}
+		std::cout << "worlds=" << worldCount
+			<< " seconds=" << seconds
+			<< " steps=" << server.getStepCount()
+			<< " droppedSteps=" << dropped << std::endl;
+		return 0;
+	}
+
+	/**
+	 * @brief Parses `--server <worlds> [seconds]` at @p index and runs the server.
+	 *
+	 * @return Exit status; 1 if the world count is not a whole number above 0 or the
+	 * seconds are not a number above 0.
+	 */
+	int
+	serverMain(int argc, char* argv[], int index) {
+		char* end = nullptr;
+		const char* worldsText = index + 1 < argc ? argv[index + 1] : "";
+		const unsigned long long worlds = std::strtoull(worldsText, &end, 10);
+		if (worldsText[0] == '-' || end == worldsText || *end != '\0' || worlds == 0) {
+			std::cerr << "--server needs a number of worlds above 0\n";
+			return 1;
+		}
+
+		double seconds = 10.0;
+		// Un argumento que no empieza con "--" es la duracion, incluso si es negativo
+		if (index + 2 < argc && std::strncmp(argv[index + 2], "--", 2) != 0) {
+			const char* secondsText = argv[index + 2];
+			seconds = std::strtod(secondsText, &end);
+			if (end == secondsText || *end != '\0' || !(seconds > 0.0)) {
+				std::cerr << "--server needs a duration above 0 seconds\n";
+				return 1;
+			}
+		}
+		return runServer(static_cast<std::size_t>(worlds), seconds);
+	}
+}
+
  /**
   * @brief Main function that initializes and runs the application.
   *
   * Creates an instance of the BaseApp class and calls its run method to start the application loop.
+  * Passing `--headless [frames]` runs the loop on a NullRenderBackend for the given number of
+  * frames (600 by default) and prints the render counters. `--profile <trace.json>` writes a
+  * Chrome trace of the run and prints the per-zone frame percentiles. `--archive <file.xpak>`
+  * mounts a packed asset archive, which may be given several times. `--record <log>` saves
+  * the session's input, delta times and seeds; `--replay <log>` runs such a log again
+  * headless, as fast as possible. `--overlay` shows the stats overlay from the start and
+  * `--telemetry <file>` streams the per-frame counters to a CSV or JSON Lines file.
+  * `--server <worlds> [seconds]` skips the app and runs that many windowless simulation
+  * worlds on a SimulationServer for the given time (10 s by default); the app and its
+  * subsystems are not created in that mode.
   *
   * @return int Exit status of the application. Returns 0 on successful execution.
   */
 int
-main() {
+main(int argc, char* argv[]) {
+	// El modo servidor no construye la app ni sus hilos
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--server") == 0) {
+			return serverMain(argc, argv, i);
+		}
+	}
+
 	BaseApp app;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--headless") == 0) {
+			uint64_t frames = 600;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				char* end = nullptr;
+				const uint64_t parsed = std::strtoull(argv[++i], &end, 10);
+				// Si no es un numero se queda el valor por defecto
+				if (end != argv[i] && *end == '\0') {
+					frames = parsed;
+				}
+			}
+			app.setHeadless(frames);
+		}
+		else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+			app.setProfileOutput(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--archive") == 0 && i + 1 < argc) {
+			app.getAssets().mountArchive(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+			if (!app.setRecordOutput(argv[++i])) {
+				return 1;
+			}
+		}
+		else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			FrameReplay replay;
+			if (!replay.load(argv[++i])) {
+				return 1;
+			}
+			app.setReplay(replay);
+		}
+		else if (std::strcmp(argv[i], "--overlay") == 0) {
+			app.setOverlayEnabled(true);
+		}
+		else if (std::strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc) {
+			app.setTelemetryOutput(argv[++i]);
+		}
+	}
 	return app.run();
-}
\ No newline at end of file
+}
@@ -0,0 +1,528 @@
+#include "Math/VectorMath.h"
+#include "Math/SIMD.h"
+#include "Math/ConstMath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/**
+ * @file VectorMath.cpp
+ * @brief Implementation of the SoA batch kernels for SSE2, AVX2 and plain scalar code.
+ *
+ * The SIMD loop of each kernel is written once against the small lane wrapper below,
+ * which maps to AVX2 or SSE2 intrinsics. The remaining elements go through the scalar loop.
+ */
+
+namespace {
+
+#if defined(XLR8_SIMD_AVX2)
+    typedef __m256 vfloat;
+    inline vfloat vload(const float* p) { return _mm256_loadu_ps(p); }
+    inline void vstore(float* p, vfloat v) { _mm256_storeu_ps(p, v); }
+    inline vfloat vset(float s) { return _mm256_set1_ps(s); }
+    inline vfloat vadd(vfloat a, vfloat b) { return _mm256_add_ps(a, b); }
+    inline vfloat vsub(vfloat a, vfloat b) { return _mm256_sub_ps(a, b); }
+    inline vfloat vmul(vfloat a, vfloat b) { return _mm256_mul_ps(a, b); }
+    inline vfloat vdiv(vfloat a, vfloat b) { return _mm256_div_ps(a, b); }
+    inline vfloat vsqrt(vfloat a) { return _mm256_sqrt_ps(a); }
+    inline vfloat vgreater(vfloat a, vfloat b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    inline vfloat vand(vfloat a, vfloat b) { return _mm256_and_ps(a, b); }
+    inline vfloat vandnot(vfloat a, vfloat b) { return _mm256_andnot_ps(a, b); }
+    inline vfloat vxor(vfloat a, vfloat b) { return _mm256_xor_ps(a, b); }
+    inline vfloat vmin(vfloat a, vfloat b) { return _mm256_min_ps(a, b); }
+    inline vfloat vmax(vfloat a, vfloat b) { return _mm256_max_ps(a, b); }
+
+    typedef __m256i vint;
+    inline vint iset(int s) { return _mm256_set1_epi32(s); }
+    inline vint itrunc(vfloat a) { return _mm256_cvttps_epi32(a); }
+    inline vfloat itofloat(vint a) { return _mm256_cvtepi32_ps(a); }
+    inline vint iadd(vint a, vint b) { return _mm256_add_epi32(a, b); }
+    inline vint isub(vint a, vint b) { return _mm256_sub_epi32(a, b); }
+    inline vint iand(vint a, vint b) { return _mm256_and_si256(a, b); }
+    inline vint iandnot(vint a, vint b) { return _mm256_andnot_si256(a, b); }
+    inline vint ishl29(vint a) { return _mm256_slli_epi32(a, 29); }
+    inline vint iequal(vint a, vint b) { return _mm256_cmpeq_epi32(a, b); }
+    inline vfloat iasfloat(vint a) { return _mm256_castsi256_ps(a); }
+#elif defined(XLR8_SIMD_SSE2)
+    typedef __m128 vfloat;
+    inline vfloat vload(const float* p) { return _mm_loadu_ps(p); }
+    inline void vstore(float* p, vfloat v) { _mm_storeu_ps(p, v); }
+    inline vfloat vset(float s) { return _mm_set1_ps(s); }
+    inline vfloat vadd(vfloat a, vfloat b) { return _mm_add_ps(a, b); }
+    inline vfloat vsub(vfloat a, vfloat b) { return _mm_sub_ps(a, b); }
+    inline vfloat vmul(vfloat a, vfloat b) { return _mm_mul_ps(a, b); }
+    inline vfloat vdiv(vfloat a, vfloat b) { return _mm_div_ps(a, b); }
+    inline vfloat vsqrt(vfloat a) { return _mm_sqrt_ps(a); }
+    inline vfloat vgreater(vfloat a, vfloat b) { return _mm_cmpgt_ps(a, b); }
+    inline vfloat vand(vfloat a, vfloat b) { return _mm_and_ps(a, b); }
+    inline vfloat vandnot(vfloat a, vfloat b) { return _mm_andnot_ps(a, b); }
+    inline vfloat vxor(vfloat a, vfloat b) { return _mm_xor_ps(a, b); }
+    inline vfloat vmin(vfloat a, vfloat b) { return _mm_min_ps(a, b); }
+    inline vfloat vmax(vfloat a, vfloat b) { return _mm_max_ps(a, b); }
+
+    typedef __m128i vint;
+    inline vint iset(int s) { return _mm_set1_epi32(s); }
+    inline vint itrunc(vfloat a) { return _mm_cvttps_epi32(a); }
+    inline vfloat itofloat(vint a) { return _mm_cvtepi32_ps(a); }
+    inline vint iadd(vint a, vint b) { return _mm_add_epi32(a, b); }
+    inline vint isub(vint a, vint b) { return _mm_sub_epi32(a, b); }
+    inline vint iand(vint a, vint b) { return _mm_and_si128(a, b); }
+    inline vint iandnot(vint a, vint b) { return _mm_andnot_si128(a, b); }
+    inline vint ishl29(vint a) { return _mm_slli_epi32(a, 29); }
+    inline vint iequal(vint a, vint b) { return _mm_cmpeq_epi32(a, b); }
+    inline vfloat iasfloat(vint a) { return _mm_castsi128_ps(a); }
+#endif
+
+    const std::size_t kWidth = XLR8_SIMD_WIDTH;
+
+    // Constantes de sinf/cosf de Cephes
+    const float kFourOverPi = 1.27323954473516f;
+    const float kPiOver4Part1 = 0.78515625f;
+    const float kPiOver4Part2 = 2.4187564849853515625e-4f;
+    const float kPiOver4Part3 = 3.77489497744594108e-8f;
+    const float kSinCoef0 = -1.9515295891e-4f;
+    const float kSinCoef1 = 8.3321608736e-3f;
+    const float kSinCoef2 = -1.6666654611e-1f;
+    const float kCosCoef0 = 2.443315711809948e-5f;
+    const float kCosCoef1 = -1.388731625493765e-3f;
+    const float kCosCoef2 = 4.166664568298827e-2f;
+
+    inline uint32_t floatBits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline float bitsFloat(uint32_t bits) {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief One easing curve at a single point. The SIMD loop of ease() computes the same
+     * expressions in the same order.
+     */
+    inline float easeScalar(EaseType type, float t) {
+        const float u = 1.f - t;
+        switch (type) {
+        case EASE_IN_QUAD:
+            return t * t;
+        case EASE_OUT_QUAD:
+            return 1.f - u * u;
+        case EASE_IN_OUT_QUAD:
+            return t > 0.5f ? 1.f - 2.f * u * u : 2.f * t * t;
+        case EASE_IN_CUBIC:
+            return t * t * t;
+        case EASE_OUT_CUBIC:
+            return 1.f - u * u * u;
+        case EASE_IN_OUT_CUBIC:
+            return t > 0.5f ? 1.f - 4.f * u * u * u : 4.f * t * t * t;
+        case EASE_SMOOTHSTEP:
+            return t * t * (3.f - 2.f * t);
+        default:
+            return t;
+        }
+    }
+
+    /**
+     * @brief Scalar version of the SIMD sincos below, step for step, so the tail of a batch
+     * gives the same results as the vector lanes.
+     */
+    inline void sinCosScalar(float angle, float& outSin, float& outCos) {
+        uint32_t signSin = floatBits(angle) & 0x80000000u;
+        float x = bitsFloat(floatBits(angle) & 0x7FFFFFFFu);
+
+        // Octante de pi/4 redondeado al par siguiente
+        int octant = static_cast<int>(x * kFourOverPi);
+        octant = (octant + 1) & ~1;
+        const float y = static_cast<float>(octant);
+
+        const uint32_t swapSin = static_cast<uint32_t>(octant & 4) << 29;
+        const bool sinUsesSinPoly = (octant & 2) == 0;
+        const uint32_t signCos = static_cast<uint32_t>(~(octant - 2) & 4) << 29;
+        signSin ^= swapSin;
+
+        x = ((x - y * kPiOver4Part1) - y * kPiOver4Part2) - y * kPiOver4Part3;
+        const float z = x * x;
+
+        const float cosPoly = ((kCosCoef0 * z + kCosCoef1) * z + kCosCoef2) * z * z - 0.5f * z + 1.f;
+        const float sinPoly = ((kSinCoef0 * z + kSinCoef1) * z + kSinCoef2) * z * x + x;
+
+        const float sinValue = sinUsesSinPoly ? sinPoly : cosPoly;
+        const float cosValue = sinUsesSinPoly ? cosPoly : sinPoly;
+        outSin = bitsFloat(floatBits(sinValue) ^ signSin);
+        outCos = bitsFloat(floatBits(cosValue) ^ signCos);
+    }
+}
+
+namespace VectorMath {
+
+    const char*
+        simdName() {
+#if defined(XLR8_SIMD_AVX2)
+        return "AVX2";
+#elif defined(XLR8_SIMD_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+
+    void
+        sinCos(const float* radians, float* outSin, float* outCos, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat signMask = iasfloat(iset(static_cast<int>(0x80000000u)));
+        const vint one = iset(1);
+        const vint notOne = iset(~1);
+        const vint two = iset(2);
+        const vint four = iset(4);
+        const vint zero = iset(0);
+        for (; i + kWidth <= count; i += kWidth) {
+            vfloat x = vload(radians + i);
+            vfloat signSin = vand(x, signMask);
+            x = vandnot(signMask, x);
+
+            vint octant = itrunc(vmul(x, vset(kFourOverPi)));
+            octant = iand(iadd(octant, one), notOne);
+            const vfloat y = itofloat(octant);
+
+            const vfloat swapSin = iasfloat(ishl29(iand(octant, four)));
+            const vfloat sinPolyMask = iasfloat(iequal(iand(octant, two), zero));
+            const vfloat signCos = iasfloat(ishl29(iandnot(isub(octant, two), four)));
+            signSin = vxor(signSin, swapSin);
+
+            x = vsub(vsub(vsub(x, vmul(y, vset(kPiOver4Part1))), vmul(y, vset(kPiOver4Part2))),
+                vmul(y, vset(kPiOver4Part3)));
+            const vfloat z = vmul(x, x);
+
+            vfloat cosPoly = vadd(vmul(vadd(vmul(vset(kCosCoef0), z), vset(kCosCoef1)), z), vset(kCosCoef2));
+            cosPoly = vadd(vsub(vmul(vmul(cosPoly, z), z), vmul(vset(0.5f), z)), vset(1.f));
+            vfloat sinPoly = vadd(vmul(vadd(vmul(vset(kSinCoef0), z), vset(kSinCoef1)), z), vset(kSinCoef2));
+            sinPoly = vadd(vmul(vmul(sinPoly, z), x), x);
+
+            // Cada salida toma el polinomio que corresponde a su octante
+            const vfloat sinValue = vadd(vand(sinPolyMask, sinPoly), vandnot(sinPolyMask, cosPoly));
+            const vfloat cosValue = vadd(vand(sinPolyMask, cosPoly), vandnot(sinPolyMask, sinPoly));
+            vstore(outSin + i, vxor(sinValue, signSin));
+            vstore(outCos + i, vxor(cosValue, signCos));
+        }
+#endif
+        for (; i < count; ++i) {
+            sinCosScalar(radians[i], outSin[i], outCos[i]);
+        }
+    }
+
+    sf::Transform
+        composeTransform(const sf::Vector2f& position, float degrees, const sf::Vector2f& scale) {
+        const float radians = wrapDegrees(degrees) * ConstMath::DEG_TO_RAD;
+        float sine;
+        float cosine;
+        sinCosScalar(radians, sine, cosine);
+        return composeTransform(position, sine, cosine, scale);
+    }
+
+    void
+        add(const float* ax, const float* ay, const float* bx, const float* by,
+            float* outX, float* outY, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(outX + i, vadd(vload(ax + i), vload(bx + i)));
+            vstore(outY + i, vadd(vload(ay + i), vload(by + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            outX[i] = ax[i] + bx[i];
+            outY[i] = ay[i] + by[i];
+        }
+    }
+
+    void
+        sub(const float* ax, const float* ay, const float* bx, const float* by,
+            float* outX, float* outY, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(outX + i, vsub(vload(ax + i), vload(bx + i)));
+            vstore(outY + i, vsub(vload(ay + i), vload(by + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            outX[i] = ax[i] - bx[i];
+            outY[i] = ay[i] - by[i];
+        }
+    }
+
+    void
+        scale(const float* ax, const float* ay, float scalar,
+            float* outX, float* outY, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat s = vset(scalar);
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(outX + i, vmul(vload(ax + i), s));
+            vstore(outY + i, vmul(vload(ay + i), s));
+        }
+#endif
+        for (; i < count; ++i) {
+            outX[i] = ax[i] * scalar;
+            outY[i] = ay[i] * scalar;
+        }
+    }
+
+    void
+        addScaled(float* ax, float* ay, const float* bx, const float* by,
+            float scalar, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat s = vset(scalar);
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(ax + i, vadd(vload(ax + i), vmul(vload(bx + i), s)));
+            vstore(ay + i, vadd(vload(ay + i), vmul(vload(by + i), s)));
+        }
+#endif
+        for (; i < count; ++i) {
+            ax[i] += bx[i] * scalar;
+            ay[i] += by[i] * scalar;
+        }
+    }
+
+    void
+        addScalar(float* values, float scalar, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat s = vset(scalar);
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(values + i, vadd(vload(values + i), s));
+        }
+#endif
+        for (; i < count; ++i) {
+            values[i] += scalar;
+        }
+    }
+
+    void
+        integrate(float* px, float* py, float* vx, float* vy, const sf::Vector2f& acceleration,
+            float damping, float dt, std::size_t count) {
+        const float stepX = acceleration.x * dt;
+        const float stepY = acceleration.y * dt;
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat dvx = vset(stepX);
+        const vfloat dvy = vset(stepY);
+        const vfloat d = vset(damping);
+        const vfloat t = vset(dt);
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat velocityX = vmul(vadd(vload(vx + i), dvx), d);
+            const vfloat velocityY = vmul(vadd(vload(vy + i), dvy), d);
+            vstore(vx + i, velocityX);
+            vstore(vy + i, velocityY);
+            vstore(px + i, vadd(vload(px + i), vmul(velocityX, t)));
+            vstore(py + i, vadd(vload(py + i), vmul(velocityY, t)));
+        }
+#endif
+        for (; i < count; ++i) {
+            vx[i] = (vx[i] + stepX) * damping;
+            vy[i] = (vy[i] + stepY) * damping;
+            px[i] += vx[i] * dt;
+            py[i] += vy[i] * dt;
+        }
+    }
+
+    void
+        dot(const float* ax, const float* ay, const float* bx, const float* by,
+            float* out, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            vstore(out + i, vadd(vmul(vload(ax + i), vload(bx + i)),
+                vmul(vload(ay + i), vload(by + i))));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = ax[i] * bx[i] + ay[i] * by[i];
+        }
+    }
+
+    void
+        length(const float* ax, const float* ay, float* out, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat x = vload(ax + i);
+            const vfloat y = vload(ay + i);
+            vstore(out + i, vsqrt(vadd(vmul(x, x), vmul(y, y))));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i]);
+        }
+    }
+
+    void
+        normalize(const float* ax, const float* ay, float* outX, float* outY, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat zero = vset(0.f);
+        const vfloat one = vset(1.f);
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat x = vload(ax + i);
+            const vfloat y = vload(ay + i);
+            const vfloat lengthSquared = vadd(vmul(x, x), vmul(y, y));
+            // 1/|v| para vectores no nulos, 0 para el vector cero
+            const vfloat inverse = vand(vgreater(lengthSquared, zero),
+                vdiv(one, vsqrt(lengthSquared)));
+            vstore(outX + i, vmul(x, inverse));
+            vstore(outY + i, vmul(y, inverse));
+        }
+#endif
+        for (; i < count; ++i) {
+            const float lengthSquared = ax[i] * ax[i] + ay[i] * ay[i];
+            const float inverse = lengthSquared > 0.f ? 1.f / std::sqrt(lengthSquared) : 0.f;
+            outX[i] = ax[i] * inverse;
+            outY[i] = ay[i] * inverse;
+        }
+    }
+
+    void
+        transform(const Affine2& m, const float* px, const float* py,
+            float* outX, float* outY, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat a = vset(m.a), b = vset(m.b), c = vset(m.c), d = vset(m.d);
+        const vfloat tx = vset(m.tx), ty = vset(m.ty);
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat x = vload(px + i);
+            const vfloat y = vload(py + i);
+            vstore(outX + i, vadd(vadd(vmul(a, x), vmul(c, y)), tx));
+            vstore(outY + i, vadd(vadd(vmul(b, x), vmul(d, y)), ty));
+        }
+#endif
+        for (; i < count; ++i) {
+            const float x = px[i];
+            const float y = py[i];
+            outX[i] = m.a * x + m.c * y + m.tx;
+            outY[i] = m.b * x + m.d * y + m.ty;
+        }
+    }
+
+    void
+        transform(const Affine2Stream& m, const float* px, const float* py,
+            float* outX, float* outY, std::size_t count) {
+        const float* ma = m.a();
+        const float* mb = m.b();
+        const float* mc = m.c();
+        const float* md = m.d();
+        const float* mtx = m.tx();
+        const float* mty = m.ty();
+
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat x = vload(px + i);
+            const vfloat y = vload(py + i);
+            vstore(outX + i, vadd(vadd(vmul(vload(ma + i), x), vmul(vload(mc + i), y)), vload(mtx + i)));
+            vstore(outY + i, vadd(vadd(vmul(vload(mb + i), x), vmul(vload(md + i), y)), vload(mty + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            const float x = px[i];
+            const float y = py[i];
+            outX[i] = ma[i] * x + mc[i] * y + mtx[i];
+            outY[i] = mb[i] * x + md[i] * y + mty[i];
+        }
+    }
+
+    void
+        advanceProgress(float* elapsed, const float* inverseDuration, float dt,
+            float* outT, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat step = vset(dt);
+        const vfloat zero = vset(0.f);
+        const vfloat one = vset(1.f);
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat time = vadd(vload(elapsed + i), step);
+            vstore(elapsed + i, time);
+            vstore(outT + i, vmin(vmax(vmul(time, vload(inverseDuration + i)), zero), one));
+        }
+#endif
+        for (; i < count; ++i) {
+            elapsed[i] += dt;
+            outT[i] = std::min(std::max(elapsed[i] * inverseDuration[i], 0.f), 1.f);
+        }
+    }
+
+    /**
+     * @brief Every lane of a call follows the same curve, and the in-out curves compute
+     * both halves and select per lane instead of branching.
+     */
+    void
+        ease(EaseType type, const float* t, float* out, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        const vfloat one = vset(1.f);
+        const vfloat two = vset(2.f);
+        const vfloat three = vset(3.f);
+        const vfloat four = vset(4.f);
+        const vfloat half = vset(0.5f);
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat x = vload(t + i);
+            const vfloat u = vsub(one, x);
+            vfloat y;
+            switch (type) {
+            case EASE_IN_QUAD:
+                y = vmul(x, x);
+                break;
+            case EASE_OUT_QUAD:
+                y = vsub(one, vmul(u, u));
+                break;
+            case EASE_IN_OUT_QUAD: {
+                const vfloat upper = vgreater(x, half);
+                y = vadd(vand(upper, vsub(one, vmul(vmul(two, u), u))),
+                    vandnot(upper, vmul(vmul(two, x), x)));
+                break;
+            }
+            case EASE_IN_CUBIC:
+                y = vmul(vmul(x, x), x);
+                break;
+            case EASE_OUT_CUBIC:
+                y = vsub(one, vmul(vmul(u, u), u));
+                break;
+            case EASE_IN_OUT_CUBIC: {
+                const vfloat upper = vgreater(x, half);
+                y = vadd(vand(upper, vsub(one, vmul(vmul(vmul(four, u), u), u))),
+                    vandnot(upper, vmul(vmul(vmul(four, x), x), x)));
+                break;
+            }
+            case EASE_SMOOTHSTEP:
+                y = vmul(vmul(x, x), vsub(three, vmul(two, x)));
+                break;
+            default:
+                y = x;
+                break;
+            }
+            vstore(out + i, y);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = easeScalar(type, t[i]);
+        }
+    }
+
+    void
+        lerp(const float* from, const float* to, const float* t, float* out, std::size_t count) {
+        std::size_t i = 0;
+#if XLR8_SIMD_WIDTH > 1
+        for (; i + kWidth <= count; i += kWidth) {
+            const vfloat a = vload(from + i);
+            vstore(out + i, vadd(a, vmul(vsub(vload(to + i), a), vload(t + i))));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = from[i] + (to[i] - from[i]) * t[i];
+        }
+    }
+}
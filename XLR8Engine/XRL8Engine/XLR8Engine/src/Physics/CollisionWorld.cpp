@@ -0,0 +1,577 @@
+#include "Physics/CollisionWorld.h"
+#include "CShape.h"
+#include "Math/ConstMath.h"
+#include "Math/VectorMath.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+/**
+ * @file CollisionWorld.cpp
+ * @brief Implementation of the sweep-and-prune broadphase and the SAT narrowphase.
+ */
+
+namespace {
+    inline float dot(const sf::Vector2f& a, const sf::Vector2f& b) { return a.x * b.x + a.y * b.y; }
+
+    template<typename Array>
+    inline void swapRemove(Array& array, std::size_t index) {
+        array[index] = array[array.size() - 1];
+        array.pop_back();
+    }
+
+    /**
+     * @brief Minimum of the projections of a polygon's vertices on an axis, relative to a point.
+     */
+    inline float minProjection(const sf::Vector2f* vertices, uint32_t count,
+        const sf::Vector2f& axis, const sf::Vector2f& origin) {
+        float result = dot(axis, vertices[0] - origin);
+        for (uint32_t i = 1; i < count; ++i) {
+            result = std::min(result, dot(axis, vertices[i] - origin));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Axis-aligned bounds of a set of points.
+     */
+    sf::FloatRect pointBounds(const sf::Vector2f* points, std::size_t count) {
+        sf::Vector2f minPoint = points[0];
+        sf::Vector2f maxPoint = minPoint;
+        for (std::size_t i = 1; i < count; ++i) {
+            minPoint.x = std::min(minPoint.x, points[i].x);
+            minPoint.y = std::min(minPoint.y, points[i].y);
+            maxPoint.x = std::max(maxPoint.x, points[i].x);
+            maxPoint.y = std::max(maxPoint.y, points[i].y);
+        }
+        return sf::FloatRect(minPoint.x, minPoint.y, maxPoint.x - minPoint.x, maxPoint.y - minPoint.y);
+    }
+}
+
+BodyId
+CollisionWorld::addCircle(const sf::Vector2f& position, float radius, uint32_t userData) {
+    return createCircle(position, sf::Vector2f(0.f, 0.f), radius, 0.f, userData);
+}
+
+BodyId
+CollisionWorld::addBox(const sf::Vector2f& position, const sf::Vector2f& halfExtents, float rotation,
+    uint32_t userData) {
+    const sf::Vector2f corners[4] = {
+        sf::Vector2f(-halfExtents.x, -halfExtents.y),
+        sf::Vector2f(halfExtents.x, -halfExtents.y),
+        sf::Vector2f(halfExtents.x, halfExtents.y),
+        sf::Vector2f(-halfExtents.x, halfExtents.y)
+    };
+    const BodyId id = createBody(COLLIDER_BOX, position, rotation, userData);
+    createPolygon(m_sparse[id], corners, 4);
+    return id;
+}
+
+BodyId
+CollisionWorld::addConvex(const sf::Vector2f& position, const std::vector<sf::Vector2f>& points,
+    float rotation, uint32_t userData) {
+    if (points.size() < 3) {
+        ERROR("CollisionWorld", "addConvex", "A convex collider needs at least 3 vertices");
+        return kInvalidBody;
+    }
+    return createConvex(COLLIDER_CONVEX, position, points.data(), points.size(), rotation, userData);
+}
+
+/**
+ * @brief Builds a collider from the local points of a CShape.
+ *
+ * A circle shape is stored by its points, so its center and radius come from their bounds.
+ */
+BodyId
+CollisionWorld::addShape(const CShape& shape, const sf::Vector2f& position, float rotation,
+    uint32_t userData) {
+    const sf::Shape* source = shape.getShape();
+    if (source == nullptr) {
+        ERROR("CollisionWorld", "addShape", "Shape is not initialized.");
+        return kInvalidBody;
+    }
+
+    const std::size_t count = source->getPointCount();
+    if (count < 3) {
+        ERROR("CollisionWorld", "addShape", "A collider needs at least 3 shape points");
+        return kInvalidBody;
+    }
+    std::vector<sf::Vector2f> points(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        points[i] = source->getPoint(i);
+    }
+
+    if (shape.getShapeType() == CIRCLE) {
+        const sf::FloatRect bounds = pointBounds(points.data(), count);
+        const sf::Vector2f center(bounds.left + bounds.width * 0.5f, bounds.top + bounds.height * 0.5f);
+        return createCircle(position, center, bounds.width * 0.5f, rotation, userData);
+    }
+
+    const ColliderType type = shape.getShapeType() == RECTANGLE ? COLLIDER_BOX : COLLIDER_CONVEX;
+    return createConvex(type, position, points.data(), count, rotation, userData);
+}
+
+/**
+ * @brief Swaps the body with the last one and shrinks every dense array.
+ */
+void
+CollisionWorld::removeBody(BodyId id) {
+    if (id == kInvalidBody) {
+        return;
+    }
+    const uint32_t index = m_sparse[id];
+    const uint32_t last = static_cast<uint32_t>(m_ids.size() - 1);
+
+    const uint32_t polygon = m_polygonIndex[index];
+    if (polygon != kNoPolygon) {
+        swapRemove(m_polygons, polygon);
+        if (polygon < m_polygons.size()) {
+            m_polygonIndex[m_polygons[polygon].owner] = polygon;
+        }
+    }
+
+    m_positions.swapRemove(index);
+    m_localCenters.swapRemove(index);
+    m_centers.swapRemove(index);
+    swapRemove(m_rotations, index);
+    swapRemove(m_radii, index);
+    swapRemove(m_minX, index);
+    swapRemove(m_minY, index);
+    swapRemove(m_maxX, index);
+    swapRemove(m_maxY, index);
+    swapRemove(m_types, index);
+    swapRemove(m_polygonIndex, index);
+    swapRemove(m_userData, index);
+    swapRemove(m_ids, index);
+
+    if (index != last) {
+        m_sparse[m_ids[index]] = index;
+        if (m_polygonIndex[index] != kNoPolygon) {
+            m_polygons[m_polygonIndex[index]].owner = index;
+        }
+    }
+    m_freeIds.push_back(id);
+    m_order.clear();
+}
+
+sf::FloatRect
+CollisionWorld::getBounds(BodyId id) const {
+    const uint32_t index = m_sparse[id];
+    return sf::FloatRect(m_minX[index], m_minY[index],
+        m_maxX[index] - m_minX[index], m_maxY[index] - m_minY[index]);
+}
+
+/**
+ * @brief Runs the three passes of a step.
+ */
+const std::vector<Contact>&
+CollisionWorld::step() {
+    m_contacts.clear();
+    updateGeometry();
+    findCandidatePairs();
+    for (const auto& pair : m_pairs) {
+        testPair(pair.first, pair.second);
+    }
+
+    m_stats.bodies = m_ids.size();
+    m_stats.candidatePairs = m_pairs.size();
+    m_stats.contacts = m_contacts.size();
+    return m_contacts;
+}
+
+BodyId
+CollisionWorld::createBody(ColliderType type, const sf::Vector2f& position, float rotation,
+    uint32_t userData) {
+    BodyId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+    else {
+        id = static_cast<BodyId>(m_sparse.size());
+        m_sparse.push_back(0);
+    }
+
+    m_sparse[id] = static_cast<uint32_t>(m_ids.size());
+    m_positions.push_back(position.x, position.y);
+    m_localCenters.push_back(0.f, 0.f);
+    m_centers.push_back(position.x, position.y);
+    m_rotations.push_back(rotation);
+    m_radii.push_back(0.f);
+    m_minX.push_back(position.x);
+    m_minY.push_back(position.y);
+    m_maxX.push_back(position.x);
+    m_maxY.push_back(position.y);
+    m_types.push_back(type);
+    m_polygonIndex.push_back(kNoPolygon);
+    m_userData.push_back(userData);
+    m_ids.push_back(id);
+    m_order.clear();
+    return id;
+}
+
+/**
+ * @brief Polygons over the vertex limit fall back to the bounding box of their points,
+ * which keeps concave or finely tessellated outlines colliding instead of failing.
+ */
+BodyId
+CollisionWorld::createConvex(ColliderType type, const sf::Vector2f& position, const sf::Vector2f* points,
+    std::size_t count, float rotation, uint32_t userData) {
+    if (count <= kMaxPolygonVertices) {
+        const BodyId id = createBody(type, position, rotation, userData);
+        createPolygon(m_sparse[id], points, count);
+        return id;
+    }
+
+    const sf::FloatRect bounds = pointBounds(points, count);
+    const sf::Vector2f corners[4] = {
+        sf::Vector2f(bounds.left, bounds.top),
+        sf::Vector2f(bounds.left + bounds.width, bounds.top),
+        sf::Vector2f(bounds.left + bounds.width, bounds.top + bounds.height),
+        sf::Vector2f(bounds.left, bounds.top + bounds.height)
+    };
+    const BodyId id = createBody(COLLIDER_CONVEX, position, rotation, userData);
+    createPolygon(m_sparse[id], corners, 4);
+    return id;
+}
+
+BodyId
+CollisionWorld::createCircle(const sf::Vector2f& position, const sf::Vector2f& localCenter,
+    float radius, float rotation, uint32_t userData) {
+    const BodyId id = createBody(COLLIDER_CIRCLE, position, rotation, userData);
+    const uint32_t index = m_sparse[id];
+    m_localCenters.set(index, localCenter);
+    m_radii[index] = radius;
+    return id;
+}
+
+/**
+ * @brief Stores the vertices counter-clockwise and precomputes the outward edge normals.
+ */
+void
+CollisionWorld::createPolygon(uint32_t body, const sf::Vector2f* points, std::size_t count) {
+    Polygon polygon;
+    polygon.count = static_cast<uint32_t>(count);
+    polygon.owner = body;
+
+    float area = 0.f;
+    for (std::size_t i = 0; i < count; ++i) {
+        const sf::Vector2f& a = points[i];
+        const sf::Vector2f& b = points[(i + 1) % count];
+        area += a.x * b.y - b.x * a.y;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        polygon.local[i] = area >= 0.f ? points[i] : points[count - 1 - i];
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const sf::Vector2f edge = polygon.local[(i + 1) % count] - polygon.local[i];
+        const float length = std::sqrt(dot(edge, edge));
+        polygon.localNormals[i] = length > 0.f
+            ? sf::Vector2f(edge.y / length, -edge.x / length)
+            : sf::Vector2f(0.f, 0.f);
+    }
+
+    m_polygonIndex[body] = static_cast<uint32_t>(m_polygons.size());
+    m_polygons.push_back(polygon);
+}
+
+/**
+ * @brief Rotates and translates every collider into world space and computes its AABB.
+ *
+ * The sines and cosines of all rotations come from a single VectorMath::sinCos batch.
+ */
+void
+CollisionWorld::updateGeometry() {
+    const std::size_t count = m_ids.size();
+    m_angles.resize(count);
+    m_sines.resize(count);
+    m_cosines.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_angles[i] = VectorMath::wrapDegrees(m_rotations[i]) * ConstMath::DEG_TO_RAD;
+    }
+    VectorMath::sinCos(m_angles.data(), m_sines.data(), m_cosines.data(), count);
+
+    const float* positionX = m_positions.x();
+    const float* positionY = m_positions.y();
+    for (std::size_t i = 0; i < count; ++i) {
+        const float sine = m_sines[i];
+        const float cosine = m_cosines[i];
+
+        if (m_types[i] == COLLIDER_CIRCLE) {
+            const float localX = m_localCenters.x()[i];
+            const float localY = m_localCenters.y()[i];
+            const float centerX = positionX[i] + cosine * localX - sine * localY;
+            const float centerY = positionY[i] + sine * localX + cosine * localY;
+            m_centers.x()[i] = centerX;
+            m_centers.y()[i] = centerY;
+            m_minX[i] = centerX - m_radii[i];
+            m_minY[i] = centerY - m_radii[i];
+            m_maxX[i] = centerX + m_radii[i];
+            m_maxY[i] = centerY + m_radii[i];
+            continue;
+        }
+
+        Polygon& polygon = m_polygons[m_polygonIndex[i]];
+        float minX = positionX[i];
+        float minY = positionY[i];
+        float maxX = minX;
+        float maxY = minY;
+        for (uint32_t v = 0; v < polygon.count; ++v) {
+            const sf::Vector2f& local = polygon.local[v];
+            const sf::Vector2f world(positionX[i] + cosine * local.x - sine * local.y,
+                positionY[i] + sine * local.x + cosine * local.y);
+            polygon.world[v] = world;
+            if (v == 0) {
+                minX = maxX = world.x;
+                minY = maxY = world.y;
+            }
+            else {
+                minX = std::min(minX, world.x);
+                minY = std::min(minY, world.y);
+                maxX = std::max(maxX, world.x);
+                maxY = std::max(maxY, world.y);
+            }
+
+            const sf::Vector2f& normal = polygon.localNormals[v];
+            polygon.worldNormals[v] = sf::Vector2f(cosine * normal.x - sine * normal.y,
+                sine * normal.x + cosine * normal.y);
+        }
+        m_minX[i] = minX;
+        m_minY[i] = minY;
+        m_maxX[i] = maxX;
+        m_maxY[i] = maxY;
+    }
+}
+
+/**
+ * @brief Sorts the bodies by the lower bound of their AABB on the sweep axis and reports
+ * every pair whose intervals overlap on both axes.
+ *
+ * The sweep axis is the one with the largest variance of AABB centers. The order survives
+ * between steps, so an insertion sort restores it in near linear time when bodies move a
+ * little each frame. It is rebuilt with std::sort after adds, removals or an axis change.
+ */
+void
+CollisionWorld::findCandidatePairs() {
+    const std::size_t count = m_ids.size();
+    m_pairs.clear();
+
+    float sum[2] = { 0.f, 0.f };
+    float sumSquares[2] = { 0.f, 0.f };
+    for (std::size_t i = 0; i < count; ++i) {
+        const float centerX = (m_minX[i] + m_maxX[i]) * 0.5f;
+        const float centerY = (m_minY[i] + m_maxY[i]) * 0.5f;
+        sum[0] += centerX;
+        sum[1] += centerY;
+        sumSquares[0] += centerX * centerX;
+        sumSquares[1] += centerY * centerY;
+    }
+    const float inverseCount = count > 0 ? 1.f / static_cast<float>(count) : 0.f;
+    const float varianceX = sumSquares[0] - sum[0] * sum[0] * inverseCount;
+    const float varianceY = sumSquares[1] - sum[1] * sum[1] * inverseCount;
+    const int axis = varianceY > varianceX ? 1 : 0;
+
+    const float* sweepMin = axis == 0 ? m_minX.data() : m_minY.data();
+    const float* sweepMax = axis == 0 ? m_maxX.data() : m_maxY.data();
+    const float* otherMin = axis == 0 ? m_minY.data() : m_minX.data();
+    const float* otherMax = axis == 0 ? m_maxY.data() : m_maxX.data();
+
+    if (m_order.size() != count || axis != m_sweepAxis) {
+        m_order.resize(count);
+        std::iota(m_order.begin(), m_order.end(), 0u);
+        std::sort(m_order.begin(), m_order.end(), [sweepMin](uint32_t a, uint32_t b) {
+            return sweepMin[a] < sweepMin[b];
+            });
+        m_sweepAxis = axis;
+    }
+    else {
+        for (std::size_t i = 1; i < count; ++i) {
+            const uint32_t body = m_order[i];
+            const float key = sweepMin[body];
+            std::size_t j = i;
+            while (j > 0 && sweepMin[m_order[j - 1]] > key) {
+                m_order[j] = m_order[j - 1];
+                --j;
+            }
+            m_order[j] = body;
+        }
+    }
+
+    // Copia los intervalos en orden de barrido para que el bucle interno sea lineal
+    m_sortedMin.resize(count);
+    m_sortedMax.resize(count);
+    m_sortedOtherMin.resize(count);
+    m_sortedOtherMax.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const uint32_t body = m_order[i];
+        m_sortedMin[i] = sweepMin[body];
+        m_sortedMax[i] = sweepMax[body];
+        m_sortedOtherMin[i] = otherMin[body];
+        m_sortedOtherMax[i] = otherMax[body];
+    }
+
+    // El fin de cada franja se busca en m_sortedMin, que esta ordenado, y los solapes
+    // del otro eje se compactan sin saltos en m_strip
+    m_strip.resize(count);
+    const float* sortedMin = m_sortedMin.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        const float maxA = m_sortedMax[i];
+        const float otherMinA = m_sortedOtherMin[i];
+        const float otherMaxA = m_sortedOtherMax[i];
+        const std::size_t end = static_cast<std::size_t>(
+            std::upper_bound(sortedMin + i + 1, sortedMin + count, maxA) - sortedMin);
+
+        std::size_t found = 0;
+        for (std::size_t j = i + 1; j < end; ++j) {
+            m_strip[found] = static_cast<uint32_t>(j);
+            found += (m_sortedOtherMin[j] <= otherMaxA) & (otherMinA <= m_sortedOtherMax[j]);
+        }
+        for (std::size_t k = 0; k < found; ++k) {
+            m_pairs.emplace_back(m_order[i], m_order[m_strip[k]]);
+        }
+    }
+}
+
+void
+CollisionWorld::testPair(uint32_t a, uint32_t b) {
+    Contact contact;
+    bool touching;
+    const bool circleA = m_types[a] == COLLIDER_CIRCLE;
+    const bool circleB = m_types[b] == COLLIDER_CIRCLE;
+
+    if (circleA && circleB) {
+        touching = circleCircle(a, b, contact);
+    }
+    else if (circleB) {
+        touching = polygonCircle(a, b, contact);
+    }
+    else if (circleA) {
+        touching = polygonCircle(b, a, contact);
+        contact.normal = -contact.normal;
+    }
+    else {
+        touching = polygonPolygon(a, b, contact);
+    }
+
+    if (touching) {
+        contact.a = m_ids[a];
+        contact.b = m_ids[b];
+        m_contacts.push_back(contact);
+    }
+}
+
+bool
+CollisionWorld::circleCircle(uint32_t a, uint32_t b, Contact& contact) const {
+    const sf::Vector2f delta = m_centers.get(b) - m_centers.get(a);
+    const float radius = m_radii[a] + m_radii[b];
+    const float distanceSquared = dot(delta, delta);
+    if (distanceSquared > radius * radius) {
+        return false;
+    }
+
+    const float distance = std::sqrt(distanceSquared);
+    contact.normal = distance > 0.f ? delta / distance : sf::Vector2f(1.f, 0.f);
+    contact.depth = radius - distance;
+    return true;
+}
+
+/**
+ * @brief SAT between a polygon and a circle.
+ *
+ * The face of least separation is found first. If the circle center lies past the end of
+ * that face, the closest vertex gives the axis instead.
+ * The normal points from the polygon to the circle.
+ */
+bool
+CollisionWorld::polygonCircle(uint32_t polygonBody, uint32_t circleBody, Contact& contact) const {
+    const Polygon& polygon = m_polygons[m_polygonIndex[polygonBody]];
+    const sf::Vector2f center = m_centers.get(circleBody);
+    const float radius = m_radii[circleBody];
+
+    uint32_t face = 0;
+    float separation = -std::numeric_limits<float>::max();
+    for (uint32_t i = 0; i < polygon.count; ++i) {
+        const float s = dot(polygon.worldNormals[i], center - polygon.world[i]);
+        if (s > radius) {
+            return false;
+        }
+        if (s > separation) {
+            separation = s;
+            face = i;
+        }
+    }
+
+    const sf::Vector2f& v1 = polygon.world[face];
+    const sf::Vector2f& v2 = polygon.world[(face + 1) % polygon.count];
+    if (separation > 0.f) {
+        const sf::Vector2f edge = v2 - v1;
+        const float along = dot(center - v1, edge);
+        const sf::Vector2f* corner = nullptr;
+        if (along <= 0.f) {
+            corner = &v1;
+        }
+        else if (along >= dot(edge, edge)) {
+            corner = &v2;
+        }
+
+        if (corner != nullptr) {
+            const sf::Vector2f delta = center - *corner;
+            const float distanceSquared = dot(delta, delta);
+            if (distanceSquared > radius * radius) {
+                return false;
+            }
+            const float distance = std::sqrt(distanceSquared);
+            contact.normal = distance > 0.f ? delta / distance : polygon.worldNormals[face];
+            contact.depth = radius - distance;
+            return true;
+        }
+    }
+
+    contact.normal = polygon.worldNormals[face];
+    contact.depth = radius - separation;
+    return true;
+}
+
+/**
+ * @brief SAT between two convex polygons, testing the edge normals of both.
+ *
+ * The axis of least penetration becomes the contact normal, pointing from a to b.
+ */
+bool
+CollisionWorld::polygonPolygon(uint32_t a, uint32_t b, Contact& contact) const {
+    const Polygon& polygonA = m_polygons[m_polygonIndex[a]];
+    const Polygon& polygonB = m_polygons[m_polygonIndex[b]];
+
+    float bestSeparation = -std::numeric_limits<float>::max();
+    sf::Vector2f bestNormal;
+
+    for (uint32_t i = 0; i < polygonA.count; ++i) {
+        const sf::Vector2f& normal = polygonA.worldNormals[i];
+        const float s = minProjection(polygonB.world, polygonB.count, normal, polygonA.world[i]);
+        if (s > 0.f) {
+            return false;
+        }
+        if (s > bestSeparation) {
+            bestSeparation = s;
+            bestNormal = normal;
+        }
+    }
+
+    for (uint32_t i = 0; i < polygonB.count; ++i) {
+        const sf::Vector2f& normal = polygonB.worldNormals[i];
+        const float s = minProjection(polygonA.world, polygonA.count, normal, polygonB.world[i]);
+        if (s > 0.f) {
+            return false;
+        }
+        if (s > bestSeparation) {
+            bestSeparation = s;
+            bestNormal = -normal;
+        }
+    }
+
+    contact.normal = bestNormal;
+    contact.depth = -bestSeparation;
+    return true;
+}
@@ -0,0 +1,282 @@
+#include "Physics/SpatialHash.h"
+#include "Core/ThreadPool.h"
+#include "ECS/Transform.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * @file SpatialHash.cpp
+ * @brief Implementation of the counting-sort spatial hash and its queries.
+ */
+
+namespace {
+    const float kMaxCell = 1073741824.f; ///< Cell coordinates are clamped to +-2^30.
+
+    inline uint64_t packCell(int32_t cellX, int32_t cellY) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+}
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize), m_inverseCellSize(1.f / cellSize) {
+}
+
+void
+SpatialHash::build(const float* x, const float* y, std::size_t count) {
+    m_x.resize(count);
+    m_y.resize(count);
+    std::copy(x, x + count, m_x.data());
+    std::copy(y, y + count, m_y.data());
+    rebuild();
+}
+
+void
+SpatialHash::build(const std::vector<const Transform*>& transforms) {
+    const std::size_t count = transforms.size();
+    m_x.resize(count);
+    m_y.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const sf::Vector2f position = transforms[i]->getPosition();
+        m_x[i] = position.x;
+        m_y[i] = position.y;
+    }
+    rebuild();
+}
+
+/**
+ * @brief Counting sort of the points by bucket.
+ *
+ * The table has at least twice as many buckets as points, so most buckets hold a single
+ * cell. Points are scattered from the back so each bucket keeps the input order.
+ */
+void
+SpatialHash::rebuild() {
+    const std::size_t count = m_x.size();
+    std::size_t tableSize = 64;
+    while (tableSize < count * 2) {
+        tableSize <<= 1;
+    }
+    m_bucketMask = static_cast<uint32_t>(tableSize - 1);
+
+    m_bucketStart.assign(tableSize + 1, 0);
+    m_itemBuckets.resize(count);
+    m_sortedX.resize(count);
+    m_sortedY.resize(count);
+    m_sortedItems.resize(count);
+    m_sortedCells.resize(count);
+
+    m_minCellX = m_minCellY = std::numeric_limits<int32_t>::max();
+    m_maxCellX = m_maxCellY = std::numeric_limits<int32_t>::min();
+    for (std::size_t i = 0; i < count; ++i) {
+        const int32_t cellX = cellCoord(m_x[i]);
+        const int32_t cellY = cellCoord(m_y[i]);
+        const uint32_t bucket = bucketOf(cellX, cellY);
+        m_itemBuckets[i] = bucket;
+        m_bucketStart[bucket]++;
+        m_minCellX = std::min(m_minCellX, cellX);
+        m_minCellY = std::min(m_minCellY, cellY);
+        m_maxCellX = std::max(m_maxCellX, cellX);
+        m_maxCellY = std::max(m_maxCellY, cellY);
+    }
+
+    // Suma de prefijos inclusiva: cada bucket apunta a su final
+    uint32_t total = 0;
+    for (std::size_t b = 0; b < tableSize; ++b) {
+        total += m_bucketStart[b];
+        m_bucketStart[b] = total;
+    }
+    m_bucketStart[tableSize] = total;
+
+    for (std::size_t i = count; i-- > 0;) {
+        const uint32_t slot = --m_bucketStart[m_itemBuckets[i]];
+        m_sortedX[slot] = m_x[i];
+        m_sortedY[slot] = m_y[i];
+        m_sortedItems[slot] = static_cast<uint32_t>(i);
+        m_sortedCells[slot] = packCell(cellCoord(m_x[i]), cellCoord(m_y[i]));
+    }
+}
+
+int32_t
+SpatialHash::cellCoord(float value) const {
+    const float cell = std::floor(value * m_inverseCellSize);
+    return static_cast<int32_t>(std::max(-kMaxCell, std::min(kMaxCell, cell)));
+}
+
+uint32_t
+SpatialHash::bucketOf(int32_t cellX, int32_t cellY) const {
+    const uint32_t hash = (static_cast<uint32_t>(cellX) * 0x8DA6B343u) ^ (static_cast<uint32_t>(cellY) * 0xD8163841u);
+    return (hash ^ (hash >> 16)) & m_bucketMask;
+}
+
+/**
+ * @brief Walks the run of the cell's bucket, skipping points of other cells that share it.
+ */
+template<typename Visitor>
+void
+SpatialHash::forEachInCell(int32_t cellX, int32_t cellY, Visitor&& visit) const {
+    const uint32_t bucket = bucketOf(cellX, cellY);
+    const uint64_t key = packCell(cellX, cellY);
+    const uint32_t end = m_bucketStart[bucket + 1];
+    for (uint32_t slot = m_bucketStart[bucket]; slot < end; ++slot) {
+        if (m_sortedCells[slot] == key) {
+            visit(slot);
+        }
+    }
+}
+
+void
+SpatialHash::queryRadius(const sf::Vector2f& center, float radius, std::vector<uint32_t>& out,
+    uint32_t exclude) const {
+    if (m_x.size() == 0) {
+        return;
+    }
+
+    const int32_t firstX = std::max(cellCoord(center.x - radius), m_minCellX);
+    const int32_t lastX = std::min(cellCoord(center.x + radius), m_maxCellX);
+    const int32_t firstY = std::max(cellCoord(center.y - radius), m_minCellY);
+    const int32_t lastY = std::min(cellCoord(center.y + radius), m_maxCellY);
+    const float radiusSquared = radius * radius;
+
+    for (int32_t cellY = firstY; cellY <= lastY; ++cellY) {
+        for (int32_t cellX = firstX; cellX <= lastX; ++cellX) {
+            forEachInCell(cellX, cellY, [&](uint32_t slot) {
+                const float dx = m_sortedX[slot] - center.x;
+                const float dy = m_sortedY[slot] - center.y;
+                if (dx * dx + dy * dy <= radiusSquared && m_sortedItems[slot] != exclude) {
+                    out.push_back(m_sortedItems[slot]);
+                }
+                });
+        }
+    }
+}
+
+void
+SpatialHash::queryAABB(const sf::FloatRect& rect, std::vector<uint32_t>& out) const {
+    if (m_x.size() == 0) {
+        return;
+    }
+
+    const float right = rect.left + rect.width;
+    const float bottom = rect.top + rect.height;
+    const int32_t firstX = std::max(cellCoord(rect.left), m_minCellX);
+    const int32_t lastX = std::min(cellCoord(right), m_maxCellX);
+    const int32_t firstY = std::max(cellCoord(rect.top), m_minCellY);
+    const int32_t lastY = std::min(cellCoord(bottom), m_maxCellY);
+
+    for (int32_t cellY = firstY; cellY <= lastY; ++cellY) {
+        for (int32_t cellX = firstX; cellX <= lastX; ++cellX) {
+            forEachInCell(cellX, cellY, [&](uint32_t slot) {
+                const float x = m_sortedX[slot];
+                const float y = m_sortedY[slot];
+                if (x >= rect.left && x <= right && y >= rect.top && y <= bottom) {
+                    out.push_back(m_sortedItems[slot]);
+                }
+                });
+        }
+    }
+}
+
+/**
+ * @brief Ring search around the cell of the center.
+ *
+ * After ring n has been visited, every unvisited point is at least n cells away, so the
+ * search stops once k points closer than n * cellSize are known or the rings cover every
+ * occupied cell.
+ */
+void
+SpatialHash::queryNearest(const sf::Vector2f& center, std::size_t k, std::vector<uint32_t>& out,
+    uint32_t exclude) const {
+    out.clear();
+    if (k == 0 || m_x.size() == 0) {
+        return;
+    }
+
+    // Monticulo de maximos con los k mejores candidatos
+    std::vector<std::pair<float, uint32_t>> best;
+    best.reserve(k + 1);
+
+    const int32_t centerX = cellCoord(center.x);
+    const int32_t centerY = cellCoord(center.y);
+    const int32_t startRing = std::max({ 0, m_minCellX - centerX, centerX - m_maxCellX,
+        m_minCellY - centerY, centerY - m_maxCellY });
+
+    auto visitCell = [&](int32_t cellX, int32_t cellY) {
+        if (cellX < m_minCellX || cellX > m_maxCellX || cellY < m_minCellY || cellY > m_maxCellY) {
+            return;
+        }
+        forEachInCell(cellX, cellY, [&](uint32_t slot) {
+            if (m_sortedItems[slot] == exclude) {
+                return;
+            }
+            const float dx = m_sortedX[slot] - center.x;
+            const float dy = m_sortedY[slot] - center.y;
+            const float distanceSquared = dx * dx + dy * dy;
+            if (best.size() < k) {
+                best.emplace_back(distanceSquared, m_sortedItems[slot]);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (distanceSquared < best.front().first) {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = std::make_pair(distanceSquared, m_sortedItems[slot]);
+                std::push_heap(best.begin(), best.end());
+            }
+            });
+    };
+
+    for (int32_t ring = startRing;; ++ring) {
+        if (ring == 0) {
+            visitCell(centerX, centerY);
+        }
+        else {
+            for (int32_t dx = -ring; dx <= ring; ++dx) {
+                visitCell(centerX + dx, centerY - ring);
+                visitCell(centerX + dx, centerY + ring);
+            }
+            for (int32_t dy = -ring + 1; dy < ring; ++dy) {
+                visitCell(centerX - ring, centerY + dy);
+                visitCell(centerX + ring, centerY + dy);
+            }
+        }
+
+        const float reach = static_cast<float>(ring) * m_cellSize;
+        if (best.size() == k && best.front().first <= reach * reach) {
+            break;
+        }
+        if (centerX - ring <= m_minCellX && centerX + ring >= m_maxCellX &&
+            centerY - ring <= m_minCellY && centerY + ring >= m_maxCellY) {
+            break;
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    out.reserve(best.size());
+    for (const auto& candidate : best) {
+        out.push_back(candidate.second);
+    }
+}
+
+void
+SpatialHash::queryRadiusBatch(const std::vector<sf::Vector2f>& centers, float radius,
+    std::vector<std::vector<uint32_t>>& results, ThreadPool& pool, bool excludeSelf) const {
+    results.resize(centers.size());
+    pool.parallelFor(centers.size(), 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            results[i].clear();
+            queryRadius(centers[i], radius, results[i],
+                excludeSelf ? static_cast<uint32_t>(i) : kNoItem);
+        }
+        });
+}
+
+void
+SpatialHash::queryNearestBatch(const std::vector<sf::Vector2f>& centers, std::size_t k,
+    std::vector<std::vector<uint32_t>>& results, ThreadPool& pool, bool excludeSelf) const {
+    results.resize(centers.size());
+    pool.parallelFor(centers.size(), 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            queryNearest(centers[i], k, results[i],
+                excludeSelf ? static_cast<uint32_t>(i) : kNoItem);
+        }
+        });
+}
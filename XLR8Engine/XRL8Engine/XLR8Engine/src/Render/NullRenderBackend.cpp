@@ -0,0 +1,71 @@
+#include "Render/NullRenderBackend.h"
+
+/**
+ * @file NullRenderBackend.cpp
+ * @brief Implementation of the headless render backend.
+ */
+
+ /**
+  * @brief Returns the queued events. A headless backend has no other event source.
+  *
+  * @param event Receives the event.
+  * @return false once the queue is empty.
+  */
+bool
+NullRenderBackend::pollEvent(sf::Event& event) {
+    if (m_nextEvent == m_events.size()) {
+        m_events.clear();
+        m_nextEvent = 0;
+        return false;
+    }
+    event = m_events[m_nextEvent++];
+    return true;
+}
+
+/**
+ * @brief Counts the clear without touching any render target.
+ *
+ * @param color Unused.
+ */
+void
+NullRenderBackend::clear(const sf::Color& color) {
+    recordClear();
+}
+
+/**
+ * @brief Counts the draw call and the vertices SFML would have submitted.
+ *
+ * @param drawable Object to draw.
+ * @param states Render states of the draw.
+ */
+void
+NullRenderBackend::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    recordDraw(countVertices(drawable), states);
+}
+
+/**
+ * @brief Counts the draw call for a raw vertex range.
+ *
+ * @param vertices Unused.
+ * @param vertexCount Number of vertices.
+ * @param type Unused.
+ * @param states Render states of the draw.
+ */
+void
+NullRenderBackend::draw(const sf::Vertex* vertices,
+    std::size_t vertexCount,
+    sf::PrimitiveType type,
+    const sf::RenderStates& states) {
+    recordDraw(vertexCount, states);
+}
+
+/**
+ * @brief Ends the frame and closes the backend once the frame budget is spent.
+ */
+void
+NullRenderBackend::display() {
+    recordDisplay();
+    if (m_maxFrames != 0 && getTotalStats().frames >= m_maxFrames) {
+        m_open = false;
+    }
+}
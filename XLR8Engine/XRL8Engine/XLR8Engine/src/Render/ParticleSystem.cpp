@@ -0,0 +1,173 @@
+#include "Render/ParticleSystem.h"
+#include "Core/ThreadPool.h"
+#include "Math/VectorMath.h"
+#include <algorithm>
+
+/**
+ * @file ParticleSystem.cpp
+ * @brief Implementation of the SoA particle pool.
+ */
+
+namespace {
+    const std::size_t kUpdateGrain = 16384; ///< Particles per parallel update chunk.
+    const std::size_t kRenderGrain = 8192;  ///< Particles per parallel vertex chunk.
+}
+
+ParticleSystem::ParticleSystem(std::size_t maxParticles)
+    : m_maxParticles(maxParticles) {
+}
+
+bool
+ParticleSystem::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float lifetime,
+    float size, const sf::Color& color) {
+    if (m_positions.size() >= m_maxParticles) {
+        m_stats.dropped++;
+        return false;
+    }
+
+    m_positions.push_back(position.x, position.y);
+    m_velocities.push_back(velocity.x, velocity.y);
+    m_life.push_back(lifetime);
+    m_inverseLifetime.push_back(1.f / lifetime);
+    m_sizes.push_back(size);
+    m_colors.push_back(color);
+    m_stats.spawned++;
+    return true;
+}
+
+/**
+ * @brief Integrates positions and velocities and ages every particle, then compacts.
+ */
+void
+ParticleSystem::update(float deltaTime, ThreadPool* pool) {
+    const std::size_t count = m_positions.size();
+    auto step = [this, deltaTime](std::size_t begin, std::size_t end) {
+        VectorMath::integrate(m_positions.x() + begin, m_positions.y() + begin,
+            m_velocities.x() + begin, m_velocities.y() + begin,
+            m_acceleration, m_damping, deltaTime, end - begin);
+        VectorMath::addScalar(m_life.data() + begin, -deltaTime, end - begin);
+    };
+
+    if (pool != nullptr) {
+        pool->parallelFor(count, kUpdateGrain, step);
+    }
+    else {
+        step(0, count);
+    }
+
+    removeExpired();
+    m_stats.alive = m_positions.size();
+}
+
+/**
+ * @brief Allocates six vertices per particle in the queue and fills them.
+ */
+void
+ParticleSystem::render(RenderQueue& queue, ThreadPool* pool) const {
+    const std::size_t count = m_positions.size();
+    if (count == 0) {
+        return;
+    }
+
+    sf::Vertex* vertices = queue.allocate(RenderKey::make(m_layer, m_blendType, 0, m_depth), count * 6);
+    auto build = [this, vertices](std::size_t begin, std::size_t end) {
+        buildVertices(begin, end, vertices + begin * 6);
+    };
+
+    if (pool != nullptr) {
+        pool->parallelFor(count, kRenderGrain, build);
+    }
+    else {
+        build(0, count);
+    }
+}
+
+void
+ParticleSystem::clear() {
+    m_positions.clear();
+    m_velocities.clear();
+    m_life.clear();
+    m_inverseLifetime.clear();
+    m_sizes.clear();
+    m_colors.clear();
+    m_stats.alive = 0;
+}
+
+void
+ParticleSystem::setRenderState(uint8_t layer, float depth, BlendType blendType) {
+    m_layer = layer;
+    m_depth = depth;
+    m_blendType = blendType;
+}
+
+/**
+ * @brief Moves the last live particle into each dead slot.
+ *
+ * The loop only writes when a particle died, so a frame without deaths is a read-only
+ * scan of the life array.
+ */
+void
+ParticleSystem::removeExpired() {
+    std::size_t count = m_positions.size();
+    float* positionX = m_positions.x();
+    float* positionY = m_positions.y();
+    float* velocityX = m_velocities.x();
+    float* velocityY = m_velocities.y();
+
+    std::size_t i = 0;
+    while (i < count) {
+        if (m_life[i] > 0.f) {
+            ++i;
+            continue;
+        }
+
+        const std::size_t last = --count;
+        positionX[i] = positionX[last];
+        positionY[i] = positionY[last];
+        velocityX[i] = velocityX[last];
+        velocityY[i] = velocityY[last];
+        m_life[i] = m_life[last];
+        m_inverseLifetime[i] = m_inverseLifetime[last];
+        m_sizes[i] = m_sizes[last];
+        m_colors[i] = m_colors[last];
+    }
+
+    m_stats.expired += m_positions.size() - count;
+    m_positions.resize(count);
+    m_velocities.resize(count);
+    m_life.resize(count);
+    m_inverseLifetime.resize(count);
+    m_sizes.resize(count);
+    m_colors.resize(count);
+}
+
+void
+ParticleSystem::buildVertices(std::size_t begin, std::size_t end, sf::Vertex* vertices) const {
+    const float* positionX = m_positions.x();
+    const float* positionY = m_positions.y();
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const float half = m_sizes[i] * 0.5f;
+        const float left = positionX[i] - half;
+        const float right = positionX[i] + half;
+        const float top = positionY[i] - half;
+        const float bottom = positionY[i] + half;
+
+        sf::Color color = m_colors[i];
+        const float fade = std::min(1.f, m_life[i] * m_inverseLifetime[i]);
+        color.a = static_cast<sf::Uint8>(static_cast<float>(color.a) * fade);
+
+        // Escribe los campos directamente; los constructores de sf::Vertex no son inline
+        vertices[0].position = sf::Vector2f(left, top);
+        vertices[1].position = sf::Vector2f(right, top);
+        vertices[2].position = sf::Vector2f(right, bottom);
+        vertices[3].position = sf::Vector2f(left, top);
+        vertices[4].position = sf::Vector2f(right, bottom);
+        vertices[5].position = sf::Vector2f(left, bottom);
+        for (int v = 0; v < 6; ++v) {
+            vertices[v].color = color;
+            vertices[v].texCoords = sf::Vector2f(0.f, 0.f);
+        }
+        vertices += 6;
+    }
+}
@@ -0,0 +1,83 @@
+#include "Render/RenderBackend.h"
+
+/**
+ * @file RenderBackend.cpp
+ * @brief Implementation of the counters shared by every render backend.
+ */
+
+ /**
+  * @brief Records a draw submission.
+  *
+  * A state change is counted whenever texture, shader or blend mode differ from the
+  * previous draw of the same frame.
+  *
+  * @param vertexCount Number of vertices submitted.
+  * @param states Render states of the draw.
+  */
+void
+RenderBackend::recordDraw(std::size_t vertexCount, const sf::RenderStates& states) {
+    const bool changed = !m_hasLastState ||
+        states.texture != m_lastTexture ||
+        states.shader != m_lastShader ||
+        states.blendMode != m_lastBlendMode;
+
+    m_frameStats.drawCalls++;
+    m_frameStats.vertices += vertexCount;
+    if (changed) {
+        m_frameStats.stateChanges++;
+    }
+
+    m_hasLastState = true;
+    m_lastTexture = states.texture;
+    m_lastShader = states.shader;
+    m_lastBlendMode = states.blendMode;
+}
+
+/**
+ * @brief Records a clear call.
+ */
+void
+RenderBackend::recordClear() {
+    m_frameStats.clears++;
+}
+
+/**
+ * @brief Closes the current frame: folds its counters into the totals and starts a new one.
+ */
+void
+RenderBackend::recordDisplay() {
+    m_frameStats.frames = 1;
+
+    m_totalStats.drawCalls += m_frameStats.drawCalls;
+    m_totalStats.vertices += m_frameStats.vertices;
+    m_totalStats.stateChanges += m_frameStats.stateChanges;
+    m_totalStats.clears += m_frameStats.clears;
+    m_totalStats.frames++;
+
+    m_lastFrameStats = m_frameStats;
+    m_frameStats.reset();
+    m_hasLastState = false;
+}
+
+/**
+ * @brief Returns how many vertices SFML submits for a drawable.
+ *
+ * Shapes are drawn as a triangle fan of the outline points plus the center and the
+ * closing point.
+ *
+ * @param drawable Object being drawn.
+ * @return Vertex count, or 0 for drawables whose geometry is not known.
+ */
+std::size_t
+RenderBackend::countVertices(const sf::Drawable& drawable) {
+    if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+        return shape->getPointCount() + 2;
+    }
+    if (const sf::VertexArray* vertexArray = dynamic_cast<const sf::VertexArray*>(&drawable)) {
+        return vertexArray->getVertexCount();
+    }
+    if (dynamic_cast<const sf::Sprite*>(&drawable)) {
+        return 4;
+    }
+    return 0;
+}
@@ -0,0 +1,286 @@
+#include "Render/RenderQueue.h"
+#include "Window.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @file RenderQueue.cpp
+ * @brief Implementation of the sorted render queue.
+ */
+
+ /**
+  * @brief Maps a float depth to an unsigned integer with the same ordering.
+  *
+  * Positive floats get their sign bit set, negative floats have every bit flipped.
+  */
+static uint32_t
+depthToBits(float depth) {
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+/**
+ * @brief Converts a BlendType into the SFML blend mode.
+ */
+static sf::BlendMode
+toBlendMode(BlendType blend) {
+    switch (blend) {
+    case BLEND_ADD:      return sf::BlendAdd;
+    case BLEND_MULTIPLY: return sf::BlendMultiply;
+    case BLEND_NONE:     return sf::BlendNone;
+    default:             return sf::BlendAlpha;
+    }
+}
+
+uint64_t
+RenderKey::make(uint8_t layer, BlendType blend, uint32_t materialId, float depth) {
+    const uint64_t blendBits = static_cast<uint64_t>(blend & 0x7u);
+    const uint64_t material = static_cast<uint64_t>(materialId & (kMaxMaterials - 1));
+    const uint64_t depthBits = static_cast<uint64_t>(depthToBits(depth));
+    if (blend == BLEND_NONE) {
+        return (static_cast<uint64_t>(layer) << 56) | (blendBits << 52) | (material << 32) | depthBits;
+    }
+    // Lo mezclado se ordena por profundidad antes que por estado
+    return (static_cast<uint64_t>(layer) << 56) | kTranslucentBit | (depthBits << 23) |
+        (blendBits << 20) | material;
+}
+
+/**
+ * @brief Returns a dense ID for a texture/shader pair.
+ *
+ * @param texture Texture used by the items, or nullptr.
+ * @param shader Shader used by the items, or nullptr.
+ * @return Material ID, 0 for untextured items without shader and for pairs past
+ *         RenderKey::kMaxMaterials.
+ */
+uint32_t
+RenderQueue::getMaterialId(const sf::Texture* texture, const sf::Shader* shader) {
+    if (texture == nullptr && shader == nullptr) {
+        return 0;
+    }
+
+    auto it = m_materials.find(std::make_pair(texture, shader));
+    if (it != m_materials.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(m_materials.size()) + 1;
+    if (id >= RenderKey::kMaxMaterials) {
+        // Sin ID propio solo se pierde el orden por material; el lote compara texturas
+        ERROR("RenderQueue", "getMaterialId", "Too many materials for the render key");
+        id = 0;
+    }
+    m_materials.emplace(std::make_pair(texture, shader), id);
+    return id;
+}
+
+/**
+ * @brief Reserves vertices for a triangle list item.
+ *
+ * @param key Sort key of the item.
+ * @param vertexCount Number of vertices, a multiple of 3.
+ * @param texture Texture sampled by the vertices, or nullptr.
+ * @param shader Shader used by the item, or nullptr.
+ * @return Pointer to the reserved vertices.
+ */
+sf::Vertex*
+RenderQueue::allocate(uint64_t key,
+    std::size_t vertexCount,
+    const sf::Texture* texture,
+    const sf::Shader* shader) {
+    DrawItem item;
+    item.texture = texture;
+    item.shader = shader;
+    item.first = static_cast<uint32_t>(m_vertexCount);
+    item.count = static_cast<uint32_t>(vertexCount);
+
+    m_entries.push_back({ key, static_cast<uint32_t>(m_items.size()) });
+    m_items.push_back(item);
+
+    // El pool conserva su tamano entre frames para no reconstruir los vertices cada vez
+    m_vertexCount += vertexCount;
+    if (m_vertexCount > m_vertices.size()) {
+        m_vertices.resize(std::max(m_vertexCount, m_vertices.size() * 2));
+    }
+    return m_vertices.data() + item.first;
+}
+
+/**
+ * @brief Submits a triangle list, copying its vertices into the queue.
+ */
+void
+RenderQueue::submit(uint64_t key,
+    const sf::Vertex* vertices,
+    std::size_t vertexCount,
+    const sf::Texture* texture,
+    const sf::Shader* shader) {
+    sf::Vertex* dst = allocate(key, vertexCount, texture, shader);
+    std::copy(vertices, vertices + vertexCount, dst);
+}
+
+/**
+ * @brief Submits a drawable drawn with its own draw call.
+ */
+void
+RenderQueue::submit(uint64_t key, const sf::Drawable& drawable, const sf::RenderStates& states) {
+    DrawItem item;
+    item.drawable = &drawable;
+    item.first = static_cast<uint32_t>(m_states.size());
+
+    m_entries.push_back({ key, static_cast<uint32_t>(m_items.size()) });
+    m_items.push_back(item);
+    m_states.push_back(states);
+}
+
+/**
+ * @brief Stable LSD radix sort over the 8 bytes of the key.
+ *
+ * A byte that is identical in every key (typically the layer and blend bits) does not
+ * reorder anything, so its pass is skipped.
+ */
+void
+RenderQueue::sort() {
+    const std::size_t count = m_entries.size();
+    if (count < 2) {
+        return;
+    }
+
+    uint32_t histograms[8][256] = {};
+    for (const SortEntry& entry : m_entries) {
+        for (int pass = 0; pass < 8; ++pass) {
+            histograms[pass][(entry.key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    m_scratch.resize(count);
+    SortEntry* src = m_entries.data();
+    SortEntry* dst = m_scratch.data();
+
+    for (int pass = 0; pass < 8; ++pass) {
+        uint32_t* histogram = histograms[pass];
+        const uint32_t firstByte = (src[0].key >> (pass * 8)) & 0xFF;
+        if (histogram[firstByte] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].key >> (pass * 8)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != m_entries.data()) {
+        m_entries.swap(m_scratch);
+    }
+}
+
+void
+RenderQueue::appendToBatch(const DrawItem& item) {
+    if (m_batchCount == 0) {
+        m_batchFirst = item.first;
+        m_batchCount = item.count;
+        return;
+    }
+    if (m_batch.empty() && m_batchFirst + m_batchCount == item.first) {
+        m_batchCount += item.count;
+        return;
+    }
+    if (m_batch.empty()) {
+        m_batch.assign(m_vertices.begin() + m_batchFirst,
+            m_vertices.begin() + m_batchFirst + m_batchCount);
+    }
+    m_batch.insert(m_batch.end(),
+        m_vertices.begin() + item.first,
+        m_vertices.begin() + item.first + item.count);
+    m_batchCount += item.count;
+}
+
+/**
+ * @brief Draws the pending batch, from the pool or from m_batch.
+ */
+void
+RenderQueue::drawBatch(Window& window, BlendType blend, const DrawItem& item) {
+    if (m_batchCount == 0) {
+        return;
+    }
+
+    sf::RenderStates states(toBlendMode(blend));
+    states.texture = item.texture;
+    states.shader = item.shader;
+    const sf::Vertex* vertices = m_batch.empty() ? m_vertices.data() + m_batchFirst : m_batch.data();
+    window.draw(vertices, m_batchCount, sf::Triangles, states);
+
+    m_batch.clear();
+    m_batchCount = 0;
+    m_stats.batches++;
+}
+
+/**
+ * @brief Sorts the items and draws them, merging neighbouring vertex ranges with the same state.
+ *
+ * @param window Window the batches are drawn into.
+ */
+void
+RenderQueue::flush(Window& window) {
+    XLR8_PROFILE_SCOPE("RenderQueue::flush");
+    m_stats = RenderQueueStats();
+    m_stats.items = static_cast<uint32_t>(m_items.size());
+
+    sort();
+
+    const DrawItem* batchItem = nullptr;
+    uint64_t batchKey = 0;
+
+    for (const SortEntry& entry : m_entries) {
+        const DrawItem& item = m_items[entry.item];
+
+        if (item.drawable != nullptr) {
+            if (batchItem != nullptr) {
+                drawBatch(window, RenderKey::blend(batchKey), *batchItem);
+                batchItem = nullptr;
+            }
+            window.draw(*item.drawable, m_states[item.first]);
+            m_stats.batches++;
+            continue;
+        }
+
+        const bool sameState = batchItem != nullptr &&
+            RenderKey::stateBits(entry.key) == RenderKey::stateBits(batchKey) &&
+            item.texture == batchItem->texture &&
+            item.shader == batchItem->shader;
+        if (!sameState && batchItem != nullptr) {
+            drawBatch(window, RenderKey::blend(batchKey), *batchItem);
+        }
+        if (!sameState) {
+            batchItem = &item;
+            batchKey = entry.key;
+        }
+
+        appendToBatch(item);
+    }
+
+    if (batchItem != nullptr) {
+        drawBatch(window, RenderKey::blend(batchKey), *batchItem);
+    }
+
+    clear();
+}
+
+/**
+ * @brief Drops every submitted item. Allocated capacity is kept for the next frame.
+ */
+void
+RenderQueue::clear() {
+    m_items.clear();
+    m_entries.clear();
+    m_vertexCount = 0;
+    m_states.clear();
+}
@@ -0,0 +1,68 @@
+#include "Render/SFMLRenderBackend.h"
+
+/**
+ * @file SFMLRenderBackend.cpp
+ * @brief Implementation of the render backend that draws into an sf::RenderWindow.
+ */
+
+ /**
+  * @brief Creates the SFML render window with a 60 FPS limit.
+  *
+  * @param width Width of the window in pixels.
+  * @param height Height of the window in pixels.
+  * @param title Title of the window.
+  */
+SFMLRenderBackend::SFMLRenderBackend(int width, int height, const std::string& title) {
+    m_windowPtr = EngineUtilities::MakeUnique<sf::RenderWindow>(
+        sf::VideoMode(width, height), title);
+
+    if (!m_windowPtr.isNull()) {
+        m_windowPtr->setFramerateLimit(60);
+        MESSAGE("SFMLRenderBackend", "SFMLRenderBackend", "Window created successfully");
+    }
+    else {
+        ERROR("SFMLRenderBackend", "SFMLRenderBackend", "Failed to create window");
+    }
+}
+
+bool
+SFMLRenderBackend::isOpen() const {
+    return !m_windowPtr.isNull() && m_windowPtr->isOpen();
+}
+
+bool
+SFMLRenderBackend::pollEvent(sf::Event& event) {
+    return m_windowPtr->pollEvent(event);
+}
+
+void
+SFMLRenderBackend::close() {
+    m_windowPtr->close();
+}
+
+void
+SFMLRenderBackend::clear(const sf::Color& color) {
+    recordClear();
+    m_windowPtr->clear(color);
+}
+
+void
+SFMLRenderBackend::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    recordDraw(countVertices(drawable), states);
+    m_windowPtr->draw(drawable, states);
+}
+
+void
+SFMLRenderBackend::draw(const sf::Vertex* vertices,
+    std::size_t vertexCount,
+    sf::PrimitiveType type,
+    const sf::RenderStates& states) {
+    recordDraw(vertexCount, states);
+    m_windowPtr->draw(vertices, vertexCount, type, states);
+}
+
+void
+SFMLRenderBackend::display() {
+    recordDisplay();
+    m_windowPtr->display();
+}
@@ -0,0 +1,201 @@
+#include "Render/StatsOverlay.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+/**
+ * @file StatsOverlay.cpp
+ * @brief Implementation of the stats overlay and its built-in pixel font.
+ */
+
+namespace {
+    const double kRefreshSeconds = 0.25;         ///< Time between text rebuilds.
+    const int kGlyphWidth = 5;                   ///< Font pixels per glyph row.
+    const int kGlyphHeight = 7;                  ///< Rows per glyph.
+    const float kMargin = 4.f;                   ///< Font pixels between the panel edge and the text.
+    const sf::Color kBackground(0, 0, 0, 160);
+    const sf::Color kTextColor(230, 230, 230, 255);
+
+    /**
+     * @struct Glyph
+     * @brief One character of the built-in font. Each row keeps its pixels in the low five
+     * bits, leftmost pixel in bit 4.
+     */
+    struct
+        Glyph {
+        char character;
+        uint8_t rows[kGlyphHeight];
+    };
+
+    const Glyph kFont[] = {
+        { ' ', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        { '0', { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E } },
+        { '1', { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E } },
+        { '2', { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F } },
+        { '3', { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E } },
+        { '4', { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 } },
+        { '5', { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E } },
+        { '6', { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E } },
+        { '7', { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 } },
+        { '8', { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E } },
+        { '9', { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C } },
+        { 'A', { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 } },
+        { 'B', { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E } },
+        { 'C', { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E } },
+        { 'D', { 0x1E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E } },
+        { 'E', { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F } },
+        { 'F', { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 } },
+        { 'G', { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F } },
+        { 'H', { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 } },
+        { 'I', { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E } },
+        { 'J', { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C } },
+        { 'K', { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 } },
+        { 'L', { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F } },
+        { 'M', { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 } },
+        { 'N', { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 } },
+        { 'O', { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E } },
+        { 'P', { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 } },
+        { 'Q', { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D } },
+        { 'R', { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 } },
+        { 'S', { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E } },
+        { 'T', { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 } },
+        { 'U', { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E } },
+        { 'V', { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 } },
+        { 'W', { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A } },
+        { 'X', { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 } },
+        { 'Y', { 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 } },
+        { 'Z', { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F } },
+        { '.', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C } },
+        { ':', { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 } },
+        { '-', { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 } },
+        { '%', { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 } },
+        { '/', { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 } },
+        { '_', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F } },
+        { '=', { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 } },
+        { '(', { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 } },
+        { ')', { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 } },
+    };
+
+    /**
+     * @brief Glyph of a character. Lower case maps to upper case; characters the font
+     * lacks draw as blanks.
+     */
+    const Glyph*
+        findGlyph(char character) {
+        if (character >= 'a' && character <= 'z') {
+            character = static_cast<char>(character - 'a' + 'A');
+        }
+        for (const Glyph& glyph : kFont) {
+            if (glyph.character == character) {
+                return &glyph;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Formats a counter value: integers without decimals, the rest with two.
+     */
+    std::string
+        formatValue(double value) {
+        char text[32];
+        if (std::fabs(value) < 1e15 && value == std::floor(value)) {
+            std::snprintf(text, sizeof(text), "%lld", static_cast<long long>(value));
+        }
+        else {
+            std::snprintf(text, sizeof(text), "%.2f", value);
+        }
+        return text;
+    }
+}
+
+void
+StatsOverlay::update(const Telemetry& telemetry) {
+    const auto now = std::chrono::steady_clock::now();
+    if (m_hasRefreshed && std::chrono::duration<double>(now - m_lastRefresh).count() < kRefreshSeconds) {
+        return;
+    }
+    m_lastRefresh = now;
+    m_hasRefreshed = true;
+
+    const FrameTimeStats times = telemetry.getFrameTimes();
+    const double frameMs = telemetry.getValue(TELEMETRY_FRAME_MS);
+    char line[128];
+    std::vector<std::string> lines;
+
+    std::snprintf(line, sizeof(line), "FPS %.0f  FRAME %.2f MS", times.p50 > 0.0 ? 1000.0 / times.p50 : 0.0, frameMs);
+    lines.push_back(line);
+    std::snprintf(line, sizeof(line), "P50 %.2f  P90 %.2f  P99 %.2f  MAX %.2f", times.p50, times.p90, times.p99, times.max);
+    lines.push_back(line);
+    lines.push_back("DRAWS " + formatValue(telemetry.getValue(TELEMETRY_DRAW_CALLS)) +
+        "  VERTS " + formatValue(telemetry.getValue(TELEMETRY_VERTICES)));
+    lines.push_back("ENTITIES " + formatValue(telemetry.getValue(TELEMETRY_ENTITIES)) +
+        "  ALLOCS " + formatValue(telemetry.getValue(TELEMETRY_ALLOCATIONS)) +
+        "  JOBS " + formatValue(telemetry.getValue(TELEMETRY_JOB_QUEUE)));
+    for (std::size_t i = TELEMETRY_BUILTIN_COUNT; i < telemetry.getCounterCount(); ++i) {
+        const CounterId counter = static_cast<CounterId>(i);
+        lines.push_back(telemetry.getCounterName(counter) + " " + formatValue(telemetry.getValue(counter)));
+    }
+
+    build(lines);
+}
+
+/**
+ * @brief Merges the lit pixels of each glyph row into runs, so a row costs one quad per
+ * run instead of one per pixel.
+ */
+void
+StatsOverlay::build(const std::vector<std::string>& lines) {
+    m_vertices.clear();
+
+    std::size_t columns = 0;
+    for (const std::string& text : lines) {
+        columns = std::max(columns, text.size());
+    }
+    const float advance = (kGlyphWidth + 1) * m_scale;
+    const float lineHeight = (kGlyphHeight + 2) * m_scale;
+    const float margin = kMargin * m_scale;
+    appendQuad(0.f, 0.f, margin * 2.f + columns * advance - m_scale,
+        margin * 2.f + lines.size() * lineHeight - 2.f * m_scale, kBackground);
+
+    for (std::size_t row = 0; row < lines.size(); ++row) {
+        const float top = margin + row * lineHeight;
+        for (std::size_t column = 0; column < lines[row].size(); ++column) {
+            const Glyph* glyph = findGlyph(lines[row][column]);
+            if (glyph == nullptr) {
+                continue;
+            }
+            const float left = margin + column * advance;
+            for (int y = 0; y < kGlyphHeight; ++y) {
+                const uint8_t bits = glyph->rows[y];
+                int x = 0;
+                while (x < kGlyphWidth) {
+                    if ((bits & (0x10 >> x)) == 0) {
+                        ++x;
+                        continue;
+                    }
+                    const int start = x;
+                    while (x < kGlyphWidth && (bits & (0x10 >> x)) != 0) {
+                        ++x;
+                    }
+                    appendQuad(left + start * m_scale, top + y * m_scale,
+                        (x - start) * m_scale, m_scale, kTextColor);
+                }
+            }
+        }
+    }
+}
+
+void
+StatsOverlay::appendQuad(float left, float top, float width, float height, const sf::Color& color) {
+    const sf::Vector2f a(left, top);
+    const sf::Vector2f b(left + width, top);
+    const sf::Vector2f c(left + width, top + height);
+    const sf::Vector2f d(left, top + height);
+    m_vertices.push_back(sf::Vertex(a, color));
+    m_vertices.push_back(sf::Vertex(b, color));
+    m_vertices.push_back(sf::Vertex(c, color));
+    m_vertices.push_back(sf::Vertex(a, color));
+    m_vertices.push_back(sf::Vertex(c, color));
+    m_vertices.push_back(sf::Vertex(d, color));
+}
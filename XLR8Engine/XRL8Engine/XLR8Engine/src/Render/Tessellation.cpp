@@ -0,0 +1,221 @@
+#include "Render/Tessellation.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @file Tessellation.cpp
+ * @brief Implementation of the ear-clipping triangulator and the tessellation cache.
+ */
+
+namespace {
+    /**
+     * @brief Twice the signed area of triangle abc, positive when abc turns the same way as
+     * an outline of positive area. Computed in double so collinear points test exactly.
+     */
+    inline double
+        orient(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c) {
+        return (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y) -
+            (static_cast<double>(b.y) - a.y) * (static_cast<double>(c.x) - a.x);
+    }
+
+    /**
+     * @brief Point in triangle test that counts the edges as inside.
+     */
+    inline bool
+        insideTriangle(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c,
+            const sf::Vector2f& point) {
+        return orient(a, b, point) >= 0.0 && orient(b, c, point) >= 0.0 && orient(c, a, point) >= 0.0;
+    }
+}
+
+namespace Tessellation {
+
+    /**
+     * @brief Ear clipping over a doubly linked ring of the outline.
+     *
+     * Only reflex vertices can lie inside an ear of a simple polygon, so each vertex keeps a
+     * reflex flag that is refreshed for the two neighbours of every clipped ear. A whole lap
+     * around the ring without finding an ear means the outline is not simple.
+     */
+    bool
+        triangulate(const std::vector<sf::Vector2f>& points, std::vector<uint32_t>& indices) {
+        indices.clear();
+
+        // Anillo sin puntos repetidos consecutivos
+        std::vector<uint32_t> ring;
+        ring.reserve(points.size());
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            if (ring.empty() || points[i] != points[ring.back()]) {
+                ring.push_back(i);
+            }
+        }
+        while (ring.size() > 1 && points[ring.front()] == points[ring.back()]) {
+            ring.pop_back();
+        }
+        if (ring.size() < 3) {
+            return false;
+        }
+
+        double area = 0.0;
+        for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+            const sf::Vector2f& a = points[ring[j]];
+            const sf::Vector2f& b = points[ring[i]];
+            area += static_cast<double>(a.x) * b.y - static_cast<double>(b.x) * a.y;
+        }
+        if (area == 0.0) {
+            return false;
+        }
+        if (area < 0.0) {
+            std::reverse(ring.begin(), ring.end());
+        }
+
+        const std::size_t count = ring.size();
+        std::vector<uint32_t> previous(count);
+        std::vector<uint32_t> next(count);
+        std::vector<uint8_t> reflex(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            previous[i] = static_cast<uint32_t>(i == 0 ? count - 1 : i - 1);
+            next[i] = static_cast<uint32_t>(i + 1 == count ? 0 : i + 1);
+        }
+
+        auto point = [&](uint32_t node) -> const sf::Vector2f& { return points[ring[node]]; };
+        auto turn = [&](uint32_t node) { return orient(point(previous[node]), point(node), point(next[node])); };
+        for (uint32_t i = 0; i < count; ++i) {
+            reflex[i] = turn(i) <= 0.0;
+        }
+
+        auto isEar = [&](uint32_t node) {
+            const uint32_t before = previous[node];
+            const uint32_t after = next[node];
+            const sf::Vector2f& a = point(before);
+            const sf::Vector2f& b = point(node);
+            const sf::Vector2f& c = point(after);
+            for (uint32_t other = next[after]; other != before; other = next[other]) {
+                if (!reflex[other]) {
+                    continue;
+                }
+                const sf::Vector2f& candidate = point(other);
+                if (candidate == a || candidate == b || candidate == c) {
+                    continue;
+                }
+                if (insideTriangle(a, b, c, candidate)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        indices.reserve((count - 2) * 3);
+        std::size_t remaining = count;
+        std::size_t misses = 0;
+        uint32_t node = 0;
+        while (remaining > 3) {
+            const uint32_t before = previous[node];
+            const uint32_t after = next[node];
+            const double corner = turn(node);
+
+            // Los vertices colineales se quitan sin emitir un triangulo de area cero
+            const bool collinear = corner == 0.0;
+            if (!collinear && (corner < 0.0 || !isEar(node))) {
+                node = after;
+                if (++misses > remaining) {
+                    return false;
+                }
+                continue;
+            }
+
+            if (!collinear) {
+                indices.push_back(ring[before]);
+                indices.push_back(ring[node]);
+                indices.push_back(ring[after]);
+            }
+            next[before] = after;
+            previous[after] = before;
+            reflex[before] = turn(before) <= 0.0;
+            reflex[after] = turn(after) <= 0.0;
+            --remaining;
+            misses = 0;
+            node = before;
+        }
+
+        if (turn(node) > 0.0) {
+            indices.push_back(ring[previous[node]]);
+            indices.push_back(ring[node]);
+            indices.push_back(ring[next[node]]);
+        }
+        return !indices.empty();
+    }
+
+    uint64_t
+        hashPoints(const std::vector<sf::Vector2f>& points) {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](uint32_t word) {
+            for (int byte = 0; byte < 4; ++byte) {
+                hash ^= (word >> (byte * 8)) & 0xFFu;
+                hash *= 1099511628211ull;
+            }
+        };
+
+        mix(static_cast<uint32_t>(points.size()));
+        for (const sf::Vector2f& point : points) {
+            uint32_t bits[2];
+            std::memcpy(&bits[0], &point.x, sizeof(float));
+            std::memcpy(&bits[1], &point.y, sizeof(float));
+            mix(bits[0]);
+            mix(bits[1]);
+        }
+        return hash;
+    }
+}
+
+TessellationCache&
+TessellationCache::getShared() {
+    static TessellationCache cache;
+    return cache;
+}
+
+EngineUtilities::TSharedPointer<PolygonMesh>
+TessellationCache::acquire(const std::vector<sf::Vector2f>& points) {
+    const uint64_t hash = Tessellation::hashPoints(points);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& bucket = m_meshes[hash];
+    for (const auto& mesh : bucket) {
+        if (mesh->points == points) {
+            m_stats.hits++;
+            return mesh;
+        }
+    }
+
+    m_stats.misses++;
+    auto mesh = EngineUtilities::MakeShared<PolygonMesh>();
+    mesh->points = points;
+    mesh->hash = hash;
+    if (!Tessellation::triangulate(points, mesh->indices)) {
+        // Contorno no simple: un abanico al menos lo dibuja
+        m_stats.failures++;
+        mesh->indices.clear();
+        for (uint32_t i = 2; i < points.size(); ++i) {
+            mesh->indices.push_back(0);
+            mesh->indices.push_back(i - 1);
+            mesh->indices.push_back(i);
+        }
+    }
+
+    bucket.push_back(mesh);
+    m_stats.meshes++;
+    return mesh;
+}
+
+void
+TessellationCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_meshes.clear();
+    m_stats.meshes = 0;
+}
+
+TessellationStats
+TessellationCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,221 @@
+#include "Render/TextureAtlas.h"
+#include <algorithm>
+
+/**
+ * @file TextureAtlas.cpp
+ * @brief Implementation of the skyline packer and the texture atlas builder.
+ */
+
+SkylinePacker::SkylinePacker(int width, int height)
+    : m_width(width), m_height(height) {
+    m_skyline.push_back({ 0, 0, width });
+}
+
+/**
+ * @brief Returns the lowest y a rectangle can take with its left edge on node @p index.
+ *
+ * The rectangle rests on the highest segment it spans.
+ *
+ * @return The y coordinate, or -1 if the rectangle leaves the bin.
+ */
+int
+SkylinePacker::fitAt(std::size_t index, int width, int height) const {
+    const int x = m_skyline[index].x;
+    if (x + width > m_width) {
+        return -1;
+    }
+
+    int y = m_skyline[index].y;
+    int widthLeft = width;
+    for (std::size_t i = index; widthLeft > 0; ++i) {
+        y = std::max(y, m_skyline[i].y);
+        if (y + height > m_height) {
+            return -1;
+        }
+        widthLeft -= m_skyline[i].width;
+    }
+    return y;
+}
+
+/**
+ * @brief Places a rectangle at the position with the lowest top edge (bottom-left rule).
+ *
+ * @param width Width of the rectangle.
+ * @param height Height of the rectangle.
+ * @param outRect Receives the placed rectangle.
+ * @return false if the rectangle does not fit.
+ */
+bool
+SkylinePacker::insert(int width, int height, sf::IntRect& outRect) {
+    std::size_t bestIndex = m_skyline.size();
+    int bestTop = m_height + 1;
+    int bestWidth = m_width + 1;
+    int bestY = 0;
+
+    for (std::size_t i = 0; i < m_skyline.size(); ++i) {
+        const int y = fitAt(i, width, height);
+        if (y < 0) {
+            continue;
+        }
+        const int top = y + height;
+        if (top < bestTop || (top == bestTop && m_skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = m_skyline[i].width;
+            bestY = y;
+        }
+    }
+
+    if (bestIndex == m_skyline.size()) {
+        return false;
+    }
+
+    outRect = sf::IntRect(m_skyline[bestIndex].x, bestY, width, height);
+
+    // El nuevo segmento tapa los segmentos que quedan debajo de el
+    m_skyline.insert(m_skyline.begin() + bestIndex, { outRect.left, bestY + height, width });
+    for (std::size_t i = bestIndex + 1; i < m_skyline.size();) {
+        const Node& previous = m_skyline[i - 1];
+        const int previousRight = previous.x + previous.width;
+        if (m_skyline[i].x >= previousRight) {
+            break;
+        }
+        const int shrink = previousRight - m_skyline[i].x;
+        m_skyline[i].x += shrink;
+        m_skyline[i].width -= shrink;
+        if (m_skyline[i].width > 0) {
+            break;
+        }
+        m_skyline.erase(m_skyline.begin() + i);
+    }
+
+    // Une segmentos vecinos a la misma altura
+    for (std::size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+        }
+        else {
+            ++i;
+        }
+    }
+
+    m_usedArea += static_cast<long long>(width) * height;
+    return true;
+}
+
+float
+SkylinePacker::getOccupancy() const {
+    return static_cast<float>(m_usedArea) / (static_cast<float>(m_width) * m_height);
+}
+
+TextureAtlas::TextureAtlas(int pageSize, int padding)
+    : m_pageSize(pageSize), m_padding(padding) {
+}
+
+/**
+ * @brief Queues an image for packing.
+ *
+ * Adding a name twice replaces the region the name points to.
+ */
+uint32_t
+TextureAtlas::addImage(const std::string& name, const sf::Image& image) {
+    const uint32_t index = static_cast<uint32_t>(m_regions.size());
+    m_images.push_back(image);
+    m_regions.push_back(AtlasRegion());
+    m_names[name] = index;
+    return index;
+}
+
+/**
+ * @brief Loads an image from disk and queues it for packing.
+ */
+uint32_t
+TextureAtlas::addImageFromFile(const std::string& name, const std::string& path) {
+    sf::Image image;
+    if (!image.loadFromFile(path)) {
+        ERROR("TextureAtlas", "addImageFromFile", "Failed to load image " + path);
+        return kInvalidRegion;
+    }
+    return addImage(name, image);
+}
+
+/**
+ * @brief Packs the queued images into as few pages as possible and uploads them.
+ *
+ * Images are packed tallest first, which keeps the skyline flat. Each image is tried on
+ * every open page of this build before a new page is started. Earlier builds are left
+ * alone: the queued images are the last regions, and their pages follow the existing ones.
+ *
+ * @return false if an image does not fit in a page or a texture could not be created.
+ */
+bool
+TextureAtlas::build() {
+    std::vector<uint32_t> order(m_images.size());
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        const sf::Vector2u sizeA = m_images[a].getSize();
+        const sf::Vector2u sizeB = m_images[b].getSize();
+        return sizeA.y != sizeB.y ? sizeA.y > sizeB.y : sizeA.x > sizeB.x;
+        });
+
+    std::vector<SkylinePacker> packers;
+    std::vector<sf::Image> pageImages;
+    const std::size_t firstRegion = m_regions.size() - m_images.size();
+    const uint32_t firstPage = static_cast<uint32_t>(m_pages.size());
+
+    for (uint32_t index : order) {
+        const sf::Vector2u size = m_images[index].getSize();
+        const int paddedWidth = static_cast<int>(size.x) + m_padding * 2;
+        const int paddedHeight = static_cast<int>(size.y) + m_padding * 2;
+        if (paddedWidth > m_pageSize || paddedHeight > m_pageSize) {
+            ERROR("TextureAtlas", "build", "Image is larger than an atlas page");
+            return false;
+        }
+
+        sf::IntRect placed;
+        uint32_t page = 0;
+        while (page < packers.size() && !packers[page].insert(paddedWidth, paddedHeight, placed)) {
+            ++page;
+        }
+        if (page == packers.size()) {
+            packers.emplace_back(m_pageSize, m_pageSize);
+            pageImages.emplace_back();
+            pageImages.back().create(m_pageSize, m_pageSize, sf::Color::Transparent);
+            packers.back().insert(paddedWidth, paddedHeight, placed);
+        }
+
+        AtlasRegion& region = m_regions[firstRegion + index];
+        region.page = firstPage + page;
+        region.rect = sf::IntRect(placed.left + m_padding, placed.top + m_padding,
+            static_cast<int>(size.x), static_cast<int>(size.y));
+        pageImages[page].copy(m_images[index], region.rect.left, region.rect.top);
+    }
+
+    for (const sf::Image& pageImage : pageImages) {
+        auto texture = EngineUtilities::MakeShared<sf::Texture>();
+        if (!texture->loadFromImage(pageImage)) {
+            ERROR("TextureAtlas", "build", "Failed to create atlas page texture");
+            return false;
+        }
+        m_pages.push_back(texture);
+    }
+
+    for (AtlasRegion& region : m_regions) {
+        if (region.page < m_pages.size()) {
+            region.texture = m_pages[region.page].get();
+        }
+    }
+
+    m_images.clear();
+    m_images.shrink_to_fit();
+    return true;
+}
+
+const AtlasRegion*
+TextureAtlas::findRegion(const std::string& name) const {
+    auto it = m_names.find(name);
+    return it != m_names.end() ? &m_regions[it->second] : nullptr;
+}
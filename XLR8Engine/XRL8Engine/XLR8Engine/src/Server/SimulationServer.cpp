@@ -0,0 +1,115 @@
+#include "Server/SimulationServer.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+/**
+ * @file SimulationServer.cpp
+ * @brief Implementation of the multi-world simulation server.
+ */
+
+namespace {
+    const double kIdleWait = 0.01; ///< Espera de run() sin mundos, en segundos.
+}
+
+SimulationServer::SimulationServer(std::size_t threadCount)
+    : m_pool(threadCount) {
+}
+
+WorldId
+SimulationServer::addWorld(const WorldSettings& settings) {
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        slot = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+    m_slots[slot].world.reset(new World(settings));
+    m_slots[slot].activeIndex = static_cast<uint32_t>(m_active.size());
+    m_active.push_back(slot);
+    return (static_cast<uint64_t>(m_slots[slot].generation) << 32) | slot;
+}
+
+World*
+SimulationServer::getWorld(WorldId id) {
+    const uint32_t index = static_cast<uint32_t>(id);
+    if (index >= m_slots.size() || m_slots[index].generation != static_cast<uint32_t>(id >> 32)) {
+        return nullptr;
+    }
+    return m_slots[index].world.get();
+}
+
+void
+SimulationServer::removeWorld(WorldId id) {
+    if (getWorld(id) == nullptr) {
+        return;
+    }
+    const uint32_t index = static_cast<uint32_t>(id);
+    Slot& slot = m_slots[index];
+
+    // Swap-remove en la lista densa
+    const uint32_t last = m_active.back();
+    m_active[slot.activeIndex] = last;
+    m_slots[last].activeIndex = slot.activeIndex;
+    m_active.pop_back();
+
+    slot.world.reset();
+    slot.generation++;
+    m_freeSlots.push_back(index);
+}
+
+uint64_t
+SimulationServer::tick(double seconds) {
+    XLR8_PROFILE_SCOPE("SimulationServer::tick");
+    m_tickSteps.assign(m_active.size(), 0);
+    m_pool.parallelFor(m_active.size(), 1, [this, seconds](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            m_tickSteps[i] = m_slots[m_active[i]].world->advance(seconds);
+        }
+    });
+
+    uint64_t steps = 0;
+    for (uint32_t worldSteps : m_tickSteps) {
+        steps += worldSteps;
+    }
+    m_stepCount += steps;
+    return steps;
+}
+
+/**
+ * @brief Each tick passes the real time measured since the previous one, so the worlds'
+ * accumulators stay exact however long the sleeps and the ticks actually take. The stop
+ * request is cleared on the way out, not on entry, so a stop() that arrives before run()
+ * starts is not lost.
+ */
+void
+SimulationServer::run(double duration) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point start = Clock::now();
+    Clock::time_point last = start;
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        const Clock::time_point now = Clock::now();
+        tick(std::chrono::duration<double>(now - last).count());
+        last = now;
+
+        double wait = m_active.empty() ? kIdleWait : std::numeric_limits<double>::max();
+        for (uint32_t slot : m_active) {
+            wait = std::min(wait, m_slots[slot].world->getTimeToNextStep());
+        }
+        if (duration > 0.0) {
+            const double remaining = duration - std::chrono::duration<double>(Clock::now() - start).count();
+            if (remaining <= 0.0) {
+                break;
+            }
+            wait = std::min(wait, remaining);
+        }
+        if (wait > 0.0) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+        }
+    }
+    m_stopRequested.store(false, std::memory_order_relaxed);
+}
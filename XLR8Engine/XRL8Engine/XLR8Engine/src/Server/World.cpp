@@ -0,0 +1,47 @@
+#include "Server/World.h"
+#include <algorithm>
+
+/**
+ * @file World.cpp
+ * @brief Implementation of the simulation world.
+ */
+
+namespace {
+    const float kMinStepRate = 1e-3f; ///< Evita pasos infinitos.
+}
+
+World::World(const WorldSettings& settings)
+    : m_settings(settings),
+    m_stepLength(1.0 / std::max(settings.stepRate, kMinStepRate)),
+    m_arena(settings.arenaBlockSize) {
+    if (settings.stepRate < kMinStepRate) {
+        ERROR("World", "World", "Step rate of " + settings.name + " is too low, clamped");
+    }
+}
+
+uint32_t
+World::advance(double seconds) {
+    XLR8_PROFILE_SCOPE("World::advance");
+    m_accumulator += std::max(seconds, 0.0);
+
+    uint32_t steps = 0;
+    const float stepLength = static_cast<float>(m_stepLength);
+    while (m_accumulator >= m_stepLength) {
+        if (steps == m_settings.maxStepsPerAdvance) {
+            // Descartar el retraso en lugar de acumularlo
+            const uint64_t behind = static_cast<uint64_t>(m_accumulator / m_stepLength);
+            m_droppedSteps += behind;
+            m_accumulator -= static_cast<double>(behind) * m_stepLength;
+            break;
+        }
+        m_accumulator -= m_stepLength;
+        if (m_stepCallback) {
+            m_stepCallback(*this, stepLength);
+        }
+        m_behaviours.update(stepLength);
+        m_tweens.update(stepLength);
+        m_stepCount++;
+        steps++;
+    }
+    return steps;
+}
@@ -1,28 +1,34 @@
 #include "Window.h"
-#include <BaseApp.h>
+#include "Render/SFMLRenderBackend.h"
 
 /**
  * @class Window
  *
- * @brief Encapsulates an SFML window, handling creation, events, rendering, and destruction.
+ * @brief Encapsulates a render backend, handling creation, events, rendering, and destruction.
  */
 
  /**
   * @brief Constructs a new Window object.
   *
-  * Initializes an SFML render window with the specified width, height, and title.
-  * It also sets the framerate limit and verifies successful creation.
+  * Initializes an SFML render backend with the specified width, height, and title.
   *
   * @param width Width of the window in pixels.
   * @param height Height of the window in pixels.
   * @param title Title of the window.
   */
-Window::Window(int width, int height, const std::string& title) {
-    m_windowPtr = EngineUtilities::MakeUnique<sf::RenderWindow>(
-        sf::VideoMode(width, height), title);
+Window::Window(int width, int height, const std::string& title)
+    : Window(new SFMLRenderBackend(width, height, title)) {
+}
+
+/**
+ * @brief Constructs a new Window object on top of an existing backend.
+ *
+ * @param backend Backend to take ownership of.
+ */
+Window::Window(RenderBackend* backend) {
+    m_backendPtr.reset(backend);
 
-    if (!m_windowPtr.isNull()) {
-        m_windowPtr->setFramerateLimit(60);
+    if (!m_backendPtr.isNull()) {
         MESSAGE("Window", "Window", "Window created successfully");
     }
     else {
@@ -34,21 +40,32 @@ Window::Window(int width, int height, const std::string& title) {
  * @brief Destroys the Window object and safely releases its resources.
  */
 Window::~Window() {
-    m_windowPtr.release();
+    destroy();
 }
 
 /**
  * @brief Handles window events such as closing.
  *
  * Processes the event queue to detect and handle user actions like closing the window.
+ * Every event is buffered in the InputSystem, which then builds the frame's snapshot.
+ * Pressing F3 toggles the stats overlay.
  */
 void Window::handleEvents() {
+    XLR8_PROFILE_SCOPE("Window::handleEvents");
+    m_input.beginFrame();
+
     sf::Event event;
-    while (m_windowPtr->pollEvent(event)) {
+    while (m_backendPtr->pollEvent(event)) {
+        m_input.pushEvent(event);
         if (event.type == sf::Event::Closed) {
-            m_windowPtr->close();
+            m_backendPtr->close();
+        }
+        else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+            setOverlayEnabled(!m_overlayEnabled);
         }
     }
+
+    m_input.endFrame();
 }
 
 /**
@@ -57,8 +74,8 @@ void Window::handleEvents() {
  * @return true if the window is open, false otherwise.
  */
 bool Window::isOpen() const {
-    if (!m_windowPtr.isNull()) {
-        return m_windowPtr->isOpen();
+    if (!m_backendPtr.isNull()) {
+        return m_backendPtr->isOpen();
     }
     else {
         ERROR("Window", "isOpen", "Window is null");
@@ -72,8 +89,8 @@ bool Window::isOpen() const {
  * @param color The color to use when clearing the window.
  */
 void Window::clear(const sf::Color& color) {
-    if (!m_windowPtr.isNull()) {
-        m_windowPtr->clear(color);
+    if (!m_backendPtr.isNull()) {
+        m_backendPtr->clear(color);
     }
     else {
         ERROR("Window", "clear", "Window is null");
@@ -87,8 +104,8 @@ void Window::clear(const sf::Color& color) {
  * @param states Optional render states to apply to the drawable.
  */
 void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
-    if (!m_windowPtr.isNull()) {
-        m_windowPtr->draw(drawable, states);
+    if (!m_backendPtr.isNull()) {
+        m_backendPtr->draw(drawable, states);
     }
     else {
         ERROR("Window", "draw", "Window is null");
@@ -96,11 +113,45 @@ void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states)
 }
 
 /**
- * @brief Displays the contents of the current frame on the screen.
+ * @brief Draws a raw range of vertices using specified render states.
+ *
+ * @param vertices Pointer to the first vertex.
+ * @param vertexCount Number of vertices to draw.
+ * @param type Primitive type of the range.
+ * @param states Optional render states to apply to the vertices.
+ */
+void Window::draw(const sf::Vertex* vertices,
+    std::size_t vertexCount,
+    sf::PrimitiveType type,
+    const sf::RenderStates& states) {
+    if (!m_backendPtr.isNull()) {
+        m_backendPtr->draw(vertices, vertexCount, type, states);
+    }
+    else {
+        ERROR("Window", "draw", "Window is null");
+    }
+}
+
+/**
+ * @brief Draws the queued items and the overlay, displays the contents of the current
+ * frame on the screen and commits its counters.
+ *
+ * The overlay is drawn last so it stays on top, and its draw call is part of the
+ * counters it shows.
  */
 void Window::display() {
-    if (!m_windowPtr.isNull()) {
-        m_windowPtr->display();
+    XLR8_PROFILE_SCOPE("Window::display");
+    if (!m_backendPtr.isNull()) {
+        m_renderQueue.flush(*this);
+        if (m_overlayEnabled) {
+            m_overlay.update(m_telemetry);
+            const std::vector<sf::Vertex>& vertices = m_overlay.getVertices();
+            if (!vertices.empty()) {
+                m_backendPtr->draw(vertices.data(), vertices.size(), sf::Triangles, sf::RenderStates::Default);
+            }
+        }
+        m_backendPtr->display();
+        m_telemetry.endFrame(m_backendPtr->getFrameStats());
     }
     else {
         ERROR("Window", "display", "Window is null");
@@ -111,5 +162,29 @@ void Window::display() {
  * @brief Destroys the window and releases its resources safely.
  */
 void Window::destroy() {
-    m_windowPtr.release();
-}
\ No newline at end of file
+    m_backendPtr.reset();
+}
+
+/**
+ * @brief Render counters of the last presented frame.
+ */
+const RenderStats& Window::getFrameStats() const {
+    return m_backendPtr->getFrameStats();
+}
+
+/**
+ * @brief Render counters accumulated since the window was created.
+ */
+const RenderStats& Window::getTotalStats() const {
+    return m_backendPtr->getTotalStats();
+}
+
+/**
+ * @brief Shows or hides the stats overlay, sampling the telemetry only while it is shown.
+ *
+ * @param enabled Whether display() draws the overlay.
+ */
+void Window::setOverlayEnabled(bool enabled) {
+    m_overlayEnabled = enabled;
+    m_telemetry.setEnabled(enabled);
+}
@@ -0,0 +1,112 @@
+#include "Assets/AssetArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+/**
+ * @file AssetPacker.cpp
+ * @brief Entry point of xlr8_pack, which packs a directory into an asset archive.
+ *
+ * Usage: xlr8_pack <output.xpak> <directory> [--store] [--align <bytes>]
+ *
+ * Every file under the directory becomes an entry named by its path relative to it, with
+ * '/' separators, which is the path the game passes to AssetManager. --store disables
+ * compression; --align sets the data alignment (16 by default).
+ *
+ * After writing, the archive is opened again and every entry is compared with its source
+ * file; any difference deletes the output and exits with status 2.
+ */
+
+namespace {
+    /**
+     * @brief Reopens the written archive and checks each entry against the file it came from.
+     */
+    bool
+        verifyArchive(const std::string& path, const std::filesystem::path& root,
+            const std::vector<std::filesystem::path>& files) {
+        AssetArchive archive;
+        if (!archive.open(path)) {
+            std::cerr << "Verify: cannot open " << path << "\n";
+            return false;
+        }
+
+        std::vector<uint8_t> scratch;
+        for (const std::filesystem::path& file : files) {
+            const std::string name = std::filesystem::relative(file, root).generic_string();
+            std::ifstream input(file, std::ios::binary);
+            const std::vector<uint8_t> expected((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+            const uint32_t index = archive.find(name);
+            const uint8_t* data = index == AssetArchive::kNotFound ? nullptr : archive.view(index, scratch);
+            if (data == nullptr || archive.getSize(index) != expected.size() ||
+                (!expected.empty() && std::memcmp(data, expected.data(), expected.size()) != 0)) {
+                std::cerr << "Verify: " << name << " does not round trip\n";
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int
+main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: xlr8_pack <output.xpak> <directory> [--store] [--align <bytes>]\n";
+        return 1;
+    }
+
+    const std::string outputPath = argv[1];
+    const std::filesystem::path root = argv[2];
+    bool compress = true;
+    uint32_t alignment = 16;
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--store") == 0) {
+            compress = false;
+        }
+        else if (std::strcmp(argv[i], "--align") == 0 && i + 1 < argc) {
+            alignment = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else {
+            std::cerr << "Unknown option " << argv[i] << "\n";
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(root, error)) {
+        std::cerr << root.string() << " is not a directory\n";
+        return 1;
+    }
+
+    // Orden fijo para que dos empaquetados del mismo arbol sean identicos
+    std::vector<std::filesystem::path> files;
+    for (const auto& item : std::filesystem::recursive_directory_iterator(root)) {
+        if (item.is_regular_file()) {
+            files.push_back(item.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    AssetArchiveWriter writer;
+    uint64_t rawBytes = 0;
+    for (const std::filesystem::path& file : files) {
+        const std::string name = std::filesystem::relative(file, root).generic_string();
+        if (!writer.addFile(name, file.string(), compress)) {
+            return 1;
+        }
+        rawBytes += std::filesystem::file_size(file);
+    }
+
+    if (!writer.write(outputPath, alignment)) {
+        return 1;
+    }
+    if (!verifyArchive(outputPath, root, files)) {
+        std::filesystem::remove(outputPath, error);
+        return 2;
+    }
+    std::cout << "Packed " << writer.getEntryCount() << " files, " << rawBytes << " bytes -> "
+        << std::filesystem::file_size(outputPath) << " bytes in " << outputPath << "\n";
+    return 0;
+}